@@ -10,7 +10,27 @@ Description: Header file for the BST<> templated class
 
 #include "BSTNode.hpp"
 #include "BSTNode.tpp"
+#include "BSTBalance.hpp"
+#include "BSTBalance.tpp"
+#include "BSTStats.hpp"
+#include "BSTStats.tpp"
+#include "PoolAllocator.hpp"
+#include "PoolAllocator.tpp"
+#include "FrozenBST.hpp"
+#include "FrozenBST.tpp"
+#include "PersistentBST.hpp"
+#include "PersistentBST.tpp"
 #include <functional>
+#include <future>
+#include <thread>
+#include <iterator>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <utility>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
 
 /*
 This class expects to template parameters: a type T and a comparator Comparator, over T
@@ -26,32 +46,197 @@ as seen below.
 //     }
 // };
 
+/*
+The optional third template parameter is the balancing policy (see BSTBalance.hpp). With the default, NoBalance,
+the shape of the tree depends on the insertion order, so sorted input degrades every operation to O(n).
+Passing AVLBalance keeps the height in O(log n) by rotating nodes in insert and erase. Wrapping a policy in
+OrderStatistics<> additionally maintains subtree sizes, which select, rank and count_range rely on. SplayBalance
+moves every node that is inserted or looked up to the root, which suits workloads where a few keys take most of
+the lookups; with it, lookups modify the tree and must not run concurrently.
+
+The optional fourth template parameter is the allocator used for the nodes. The default, PoolAllocator<T>, gives each
+tree its own pool (see PoolAllocator.hpp): nodes come from contiguous blocks, erased nodes are recycled, and a tree
+of trivially destructible values is freed in one pass over the blocks instead of one node at a time. The one
+exception is split, whose result keeps its nodes and so shares the pool of the tree it came from.
+
+The optional fifth template parameter is the statistics policy (see BSTStats.hpp). The default, NoStats, compiles
+to nothing. CountingStats counts operations, comparator calls and allocations and records how deep inserts and
+searches go, which tells a degenerate tree from a balanced one; stats() returns a snapshot of the counters.
+*/
+
+
+
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+class BSTMap;
+
+template<class T, typename Comparator, typename Balance, typename Allocator>
+class BSTMultiset;
 
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+class LRUCache;
 
-template<class T, typename Comparator = std::less_equal<T> >
+
+template<class T, typename Comparator = std::less_equal<T>, typename Balance = NoBalance, typename Allocator = PoolAllocator<T>,
+         typename Stats = NoStats>
 class BST {
+    // BSTMap runs its own key searches over the tree and links the nodes it creates
+    template<class K, class V, class Compare, typename MapBalance, typename MapAllocator>
+    friend class BSTMap;
+    // so does BSTMultiset, whose nodes hold a value and a count
+    template<class U, typename MultisetComparator, typename MultisetBalance, typename MultisetAllocator>
+    friend class BSTMultiset;
+    // and LRUCache, whose nodes also link the entries in order of use
+    template<class K, class V, typename CacheComparator, typename CacheBalance, typename CacheAllocator>
+    friend class LRUCache;
+
+    public:
+    // the nodes the tree allocates: a BSTNode<T> with the fields the policy keeps (see BSTAugmentedNode in
+    // BSTNode.hpp); every BSTNode<T>* handle the tree returns points to one
+    typedef BSTAugmentedNode<T, Balance::tracksHeight, Balance::tracksSize, Balance::tracksAccesses> Node;
 
     private:
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator;
+    typedef std::allocator_traits<NodeAllocator> NodeAllocatorTraits;
+
+    // subtrees smaller than this are never split between threads
+    static const size_t parallelThreshold = 1 << 14;
+    // forked tasks need an allocator of their own: a new pool, or a copy of a thread-safe allocator
+    static constexpr bool canFork = IsPoolAllocator<NodeAllocator>::value || NodeAllocatorTraits::is_always_equal::value;
+
+    // calls the comparator, counting the call
+    bool compare(const T &a, const T &b) const;
+    // allocates a node holding value
+    BSTNode<T>* createNode(const T &value);
+    // allocates a node whose value is constructed from args
+    template<class... Args>
+    BSTNode<T>* emplaceNode(Args&&... args);
+    static BSTNode<T>* createNode(const T &value, NodeAllocator &nodeAllocator);
+    // destroys a node and gives its memory back
+    void destroyNode(BSTNode<T> *node);
     void transplant(BSTNode<T> *oldNode, BSTNode<T> *newNode);
+    // iterative walks; use no recursion and no stack, so degenerate trees of any depth are fine
     void deleteSubTree(BSTNode<T> *node);
-    BSTNode<T>* copySubTree(BSTNode<T> *node);
-
-    BSTNode<T> *root;
+    static void deleteSubTree(BSTNode<T> *node, NodeAllocator &nodeAllocator, bool release);
+    static BSTNode<T>* copySubTree(BSTNode<T> *node, NodeAllocator &nodeAllocator);
+    // copies a subtree of count values with up to parallelism threads
+    BSTNode<T>* copySubTree(BSTNode<T> *node, size_t count);
+    // fork-join walks; split off the left subtree to a new thread while threads remain and the subtree holds at
+    // least parallelThreshold values, and fall back to the iterative walks below that
+    static size_t childSize(BSTNode<T> *child, size_t parentSize);
+    static NodeAllocator taskAllocator(const NodeAllocator &nodeAllocator);
+    static void adoptTaskAllocator(NodeAllocator &nodeAllocator, const NodeAllocator &task);
+    static BSTNode<T>* parallelCopySubTree(BSTNode<T> *node, size_t count, unsigned threads, NodeAllocator &nodeAllocator);
+    static void parallelDeleteSubTree(BSTNode<T> *node, size_t count, unsigned threads, NodeAllocator &nodeAllocator, bool release);
+    template<class Result, class Map, class Combine>
+    static Result parallelReduce(BSTNode<T> *node, size_t count, unsigned threads, const Result &identity, Map &map, Combine &combine);
+    static unsigned defaultParallelism(void);
+    // builds a perfectly balanced subtree from the next count values of an in-order sequence
+    template<class ForwardIt>
+    BSTNode<T>* buildSubTree(ForwardIt &next, size_t count);
+    // builds the subtree rooted at index k of count values in Eytzinger order (see FrozenBST.hpp)
+    BSTNode<T>* buildImplicitSubTree(const T *values, size_t count, size_t k);
+    // number of values less than value, or less than or equal to it if inclusive; needs subtree sizes
+    size_t countBelow(const T &value, bool inclusive) const;
+    // first node that is not less than value (or, if strict, greater than value); nullptr if there is none
+    BSTNode<T>* lowerBoundNode(const T &value, bool strict) const;
+    // links a new leaf below parent (or as the root if parent is nullptr) and lets the policy rebalance
+    void linkNode(BSTNode<T> *parent, BSTNode<T> *node, bool asLeftChild);
+    // links a node with no links where its value belongs
+    void insertNode(BSTNode<T> *newNode);
+    // links a node with no links where its value belongs, searching from hint instead of the root
+    void insertNodeNear(BSTNode<T> *hint, BSTNode<T> *newNode);
+
+    // set algebra; trees are flattened into in-order chains linked through right children ("vines"), combined,
+    // and relinked into perfectly balanced trees, reusing every node
+    enum SetOperation { MergeValues, UniteValues, IntersectValues, SubtractValues };
+    static BSTNode<T>* toVine(BSTNode<T> *node);
+    static void appendToVine(BSTNode<T> *&head, BSTNode<T> *&tail, BSTNode<T> *node);
+    static BSTNode<T>* fromVine(BSTNode<T> *&next, size_t count);
+    static void detach(BSTNode<T> *node);
+    static bool fewerThanLinear(size_t n, size_t m);
+    // true if this tree's allocator can free tree's nodes, adopting its pool if needed
+    bool canAdoptNodes(BST<T, Comparator, Balance, Allocator, Stats> &tree);
+    BSTNode<T>* takeNode(BSTNode<T> *node, BST<T, Comparator, Balance, Allocator, Stats> &tree, bool adopted);
+    void combine(BST<T, Comparator, Balance, Allocator, Stats> &tree, SetOperation operation);
+
+    // mutable: a policy may restructure the tree on lookups (see SplayBalance)
+    mutable BSTNode<T> *root;
     size_t numNodes;
     Comparator comparator;
+    NodeAllocator allocator;
+    // number of threads the copy, destruction and reduce walks may use
+    unsigned parallelism;
+    // takes no space with NoStats
+    [[no_unique_address]] mutable Stats statistics;
 
 
     public:
+    // Bidirectional iterator over the values in order. Stepping follows BSTNode<T>::successor/predecessor,
+    // so iterating allocates nothing. Values are read-only: changing one in place could break the ordering.
+    class iterator {
+        private:
+        BSTNode<T> *node;
+        const BST<T, Comparator, Balance, Allocator, Stats> *tree;
+
+        public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        iterator(void) : node(nullptr), tree(nullptr) {}
+        iterator(BSTNode<T> *node, const BST<T, Comparator, Balance, Allocator, Stats> *tree) : node(node), tree(tree) {}
+
+        // node the iterator points at, nullptr for end(); can be passed to BST::erase
+        BSTNode<T>* getNode(void) const { return node; }
+
+        reference operator*(void) const { return node->getValue(); }
+        pointer operator->(void) const { return &node->getValue(); }
+
+        iterator& operator++(void) { node = node->successor(); return *this; }
+        iterator operator++(int) { iterator old = *this; ++(*this); return old; }
+        // decrementing end() yields the maximum
+        iterator& operator--(void) { node = (node == nullptr) ? tree->root->treeMax() : node->predecessor(); return *this; }
+        iterator operator--(int) { iterator old = *this; --(*this); return old; }
+
+        bool operator==(const iterator &rhs) const { return node == rhs.node; }
+        bool operator!=(const iterator &rhs) const { return node != rhs.node; }
+    };
+    typedef iterator const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef reverse_iterator const_reverse_iterator;
+
+
     // default constructor
-    BST<T, Comparator>(Comparator comparator = Comparator());
+    BST(Comparator comparator = Comparator(), const Allocator &allocator = Allocator());
 
 
     // copy constructor
-    BST<T, Comparator>(const BST<T, Comparator> &tree);
+    BST(const BST<T, Comparator, Balance, Allocator, Stats> &tree);
+
+
+    // move constructor; tree is left empty, with a new allocator (with PoolAllocator, a pool of its own), so it can
+    // be reused on another thread and this tree's pool stays unshared
+    BST(BST<T, Comparator, Balance, Allocator, Stats> &&tree) noexcept;
+
+
+    // range constructor; see assign
+    template<class InputIt>
+    BST(InputIt first, InputIt last, Comparator comparator = Comparator(), const Allocator &allocator = Allocator());
+
+
+    // list constructor; the list must already be in order, e.g. the result of getInOrderTraversal; see assignSorted
+    template<class ListAllocator>
+    BST(const DoublyLinkedList<T, ListAllocator> &sortedList, Comparator comparator = Comparator(), const Allocator &allocator = Allocator());
 
 
     // assignment operator
-    BST<T, Comparator>& operator=(const BST<T, Comparator> &tree);
+    BST<T, Comparator, Balance, Allocator, Stats>& operator=(const BST<T, Comparator, Balance, Allocator, Stats> &tree);
+
+
+    // move assignment operator; swaps the contents
+    BST<T, Comparator, Balance, Allocator, Stats>& operator=(BST<T, Comparator, Balance, Allocator, Stats> &&tree) noexcept;
 
 
     // checks if is empty
@@ -62,12 +247,47 @@ class BST {
     size_t size(void) const;
 
 
+    // get_allocator; a copy of the allocator of the nodes, rebound to T
+    Allocator get_allocator(void) const;
+
+
     // destructor
-    ~BST<T, Comparator>(void);
+    ~BST(void);
+
+
+    // assign
+    // replaces the contents with the values in [first, last), sorting them only if they are out of order,
+    // and builds a perfectly balanced tree in O(n) once they are sorted
+    template<class InputIt>
+    void assign(InputIt first, InputIt last);
+
+
+    // assignSorted
+    // replaces the contents with the values in [first, last), which must already be in order, in O(n)
+    // without a single comparison
+    template<class ForwardIt>
+    void assignSorted(ForwardIt first, ForwardIt last);
+
+
+    // assign from a list that is already in order, e.g. the result of getInOrderTraversal; see assignSorted
+    template<class ListAllocator>
+    void assign(const DoublyLinkedList<T, ListAllocator> &sortedList);
 
 
     // insert
-    BSTNode<T>* insert(T value);
+    BSTNode<T>* insert(const T &value);
+
+
+    // insert with a hint; hint is a node of this tree close to where value belongs, such as the node the previous
+    // insert returned, or nullptr to search from the root. The search climbs from hint only as far as it must and
+    // descends from there, so it costs O(log d) comparisons for a value d places away from hint, and one for a
+    // value next to it, as when appending in order. The tree is the same as with insert(value).
+    BSTNode<T>* insert(BSTNode<T> *hint, const T &value);
+
+
+    // emplace_hint; insert(hint, value) with the value constructed in place from args
+    template<class... Args>
+    BSTNode<T>* emplace_hint(BSTNode<T> *hint, Args&&... args);
  
     
     // delete
@@ -77,7 +297,44 @@ class BST {
 
 
     // search
-    BSTNode<T>* search(T value) const;
+    BSTNode<T>* search(const T &value) const;
+
+
+    // search_batch; results[i] = search(values[i]) for every i < count. Up to 16 searches descend in lockstep, one
+    // level each per round, and each prefetches the node it moves to, so their cache misses overlap instead of
+    // waiting on each other. The balancing policy hears about the accessed nodes once each group of 16 is done.
+    // results must have room for count pointers.
+    void search_batch(const T *values, size_t count, BSTNode<T> **results) const;
+
+
+    // contains_batch; results[i] is true if values[i] is in the tree, as search_batch finds it
+    // returns the number of values found
+    size_t contains_batch(const T *values, size_t count, bool *results) const;
+
+#if __cplusplus >= 202002L
+    // the same over spans
+    // throws std::invalid_argument if results is shorter than values
+    void search_batch(std::span<const T> values, std::span<BSTNode<T>*> results) const;
+    size_t contains_batch(std::span<const T> values, std::span<bool> results) const;
+#endif
+
+
+    // lower_bound; iterator to the first value that is not less than value, end() if there is none
+    iterator lower_bound(const T &value) const;
+
+
+    // upper_bound; iterator to the first value that is greater than value, end() if there is none
+    iterator upper_bound(const T &value) const;
+
+
+    // equal_range; the range of values equal to value, as (lower_bound(value), upper_bound(value))
+    std::pair<iterator, iterator> equal_range(const T &value) const;
+
+
+    // visitRange; calls visit(value) on every value v with lo <= v <= hi, in order
+    // touches only the O(height + k) nodes on the way to lo and in the range
+    template<class Visitor>
+    void visitRange(const T &lo, const T &hi, Visitor visit) const;
 
 
     // min
@@ -100,4 +357,122 @@ class BST {
 
     // postorder
     DoublyLinkedList<T> getPostOrderTraversal(void) const;
+
+
+    // visitors; call visit(value) on every value in the given order without allocating
+    // do nothing if the tree is empty
+    template<class Visitor>
+    void visitPreOrder(Visitor visit) const;
+
+
+    template<class Visitor>
+    void visitInOrder(Visitor visit) const;
+
+
+    template<class Visitor>
+    void visitPostOrder(Visitor visit) const;
+
+
+    // order statistics; these need a policy that tracks subtree sizes, e.g. OrderStatistics<AVLBalance>,
+    // and run in O(height)
+
+    // select; the k-th smallest value, counting from 0
+    // throws std::out_of_range if k >= size()
+    BSTNode<T>* select(size_t k) const;
+
+
+    // rank; the number of values less than value
+    size_t rank(const T &value) const;
+
+
+    // count_range; the number of values v with lo <= v <= hi
+    size_t count_range(const T &lo, const T &hi) const;
+
+
+    // set algebra; each takes the nodes of tree, leaving it empty, and reuses them instead of allocating
+    // (values are copied only if the allocators cannot share nodes). They run in O(n + m), or in O(m log n) when
+    // tree is much smaller, and leave a perfectly balanced tree behind. Duplicates follow the std:: algorithms.
+
+    // merge; adds every value of tree, as std::merge
+    void merge(BST<T, Comparator, Balance, Allocator, Stats> &&tree);
+
+
+    // unite; adds the values of tree not present yet, as std::set_union
+    void unite(BST<T, Comparator, Balance, Allocator, Stats> &&tree);
+
+
+    // intersect; keeps only the values also present in tree, as std::set_intersection
+    void intersect(BST<T, Comparator, Balance, Allocator, Stats> &&tree);
+
+
+    // subtract; removes the values present in tree, as std::set_difference
+    void subtract(BST<T, Comparator, Balance, Allocator, Stats> &&tree);
+
+
+    // split; moves the values not less than key to the returned tree, in O(n)
+    // The returned tree keeps its nodes where they are, so it shares this tree's allocator; with the default
+    // PoolAllocator, that is one pool, which is not thread-safe. The two trees must not be modified (or destroyed)
+    // from different threads at the same time. To hand one of them to another thread, copy it: a copy allocates
+    // its nodes from a pool of its own.
+    BST<T, Comparator, Balance, Allocator, Stats> split(const T &key);
+
+
+    // join; appends the values of tree, which must all be not less than the maximum of this tree, in O(n + m)
+    // throws std::invalid_argument if they are not
+    void join(BST<T, Comparator, Balance, Allocator, Stats> &&tree);
+
+
+    // setParallelism
+    // number of threads that copying, destroying and reduce may use for this tree; defaults to the number of
+    // hardware threads, and only subtrees of at least 16384 values are ever split off
+    void setParallelism(unsigned threads);
+
+
+    // reduce
+    // folds the values in order with combine(result, map(value)), starting from identity; combine must be
+    // associative, as large subtrees are folded on separate threads
+    template<class Result, class Map, class Combine>
+    Result reduce(Result identity, Map map, Combine combine) const;
+
+
+    // freeze
+    // returns an immutable snapshot of the current values, laid out for fast searches (see FrozenBST.hpp)
+    FrozenBST<T, Comparator> freeze(void) const;
+
+
+    // snapshot
+    // returns a persistent copy of the current values, walking all n nodes and allocating a second tree: O(n)
+    // time and memory. It is meant for converting a tree once; copies of the result are O(1), and the result
+    // offers the BST operations callers need (see PersistentBST.hpp), so hold it instead of snapshotting again.
+    PersistentBST<T, Comparator> snapshot(void) const;
+
+
+    // save
+    // writes the values to a binary snapshot file at path in O(n); T must be trivially copyable
+    // the file can be loaded back with load, or searched in place with MappedBST (see MappedBST.hpp, which is
+    // POSIX-only and included separately)
+    // throws std::runtime_error if the file cannot be written
+    void save(const std::string &path) const;
+
+
+    // load
+    // replaces the contents with the values of a snapshot file written by save, in O(n) without comparisons;
+    // T must be trivially copyable
+    // throws std::runtime_error if the file cannot be read or is not a snapshot of T
+    void load(const std::string &path);
+
+
+    // stats
+    // snapshot of the counters collected by the statistics policy; empty with the default NoStats
+    typename Stats::Snapshot stats(void) const;
+
+
+    // iterators, in order
+    iterator begin(void) const;
+    iterator end(void) const;
+
+
+    // reverse iterators, from the maximum down
+    reverse_iterator rbegin(void) const;
+    reverse_iterator rend(void) const;
 };
@@ -8,6 +8,11 @@ Written by: Duc T.
 #include <cstdlib>
 #include <cassert>
 #include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <type_traits>
 #include "BST.hpp"
 
 using namespace std;
@@ -23,12 +28,78 @@ struct BSTComparator {
     }
 };
 
+// Compare function.
+// Description: This function calls the comparator and lets the statistics policy count the call.
+// Parameters: two values, a and b.
+// Return value: true if a <= b, and false otherwise.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+bool BST<T,Comparator,Balance,Allocator,Stats>::compare(const T &a, const T &b) const{
+    statistics.countComparison();
+    return comparator(a, b);
+}
+
+// Create node function.
+// Description: This function allocates a node from the tree's allocator.
+// Parameters: the value of the node.
+// Return value: the new node, with no parent or children.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::createNode(const T &value){
+    BSTNode<T> *node = createNode(value, allocator);
+    statistics.recordAllocations(1);
+    return node;
+}
+
+// Create node function.
+// Description: This function allocates a node from a given allocator.
+// Parameters: the value of the node, the allocator.
+// Return value: the new node, with no parent or children.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::createNode(const T &value, NodeAllocator &nodeAllocator){
+    Node *node = NodeAllocatorTraits::allocate(nodeAllocator, 1);
+    try {
+        NodeAllocatorTraits::construct(nodeAllocator, node, value);
+    } catch (...) {
+        NodeAllocatorTraits::deallocate(nodeAllocator, node, 1);
+        throw;
+    }
+    return node;
+}
+
+// Emplace node function.
+// Description: This function allocates a node from the tree's allocator and constructs its value in place.
+// Parameters: the arguments the value is constructed from.
+// Return value: the new node, with no parent or children.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class... Args>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::emplaceNode(Args&&... args){
+    Node *node = NodeAllocatorTraits::allocate(allocator, 1);
+    try {
+        NodeAllocatorTraits::construct(allocator, node, in_place, std::forward<Args>(args)...);
+    } catch (...) {
+        NodeAllocatorTraits::deallocate(allocator, node, 1);
+        throw;
+    }
+    statistics.recordAllocations(1);
+    return node;
+}
+
+// Destroy node function.
+// Description: This function destroys a node and gives its memory back to the tree's allocator.
+// Parameters: the node to destroy.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::destroyNode(BSTNode<T> *node){
+    NodeAllocatorTraits::destroy(allocator, static_cast<Node *>(node));
+    NodeAllocatorTraits::deallocate(allocator, static_cast<Node *>(node), 1);
+    statistics.recordDeallocations(1);
+}
+
 // Transplant function.
 // Description: This function replaces one subtree as a child of its parent with another subtree.
 // Parameters: the root of the subtree to be replaced, the root of the subtree to replace it with.
 // Return value: NONE.
-template<class T, typename Comparator>
-void BST<T,Comparator>::transplant(BSTNode<T> *oldNode, BSTNode<T> *newNode){
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::transplant(BSTNode<T> *oldNode, BSTNode<T> *newNode){
     if (oldNode -> parent == NULL){
         this -> root = newNode;
     }
@@ -36,7 +107,7 @@ void BST<T,Comparator>::transplant(BSTNode<T> *oldNode, BSTNode<T> *newNode){
         oldNode->parent->left = newNode;
     }
     else {
-        oldNode->parent->right = newNode
+        oldNode->parent->right = newNode;
     }
     if (newNode != NULL){
         newNode->parent = oldNode->parent;
@@ -44,143 +115,683 @@ void BST<T,Comparator>::transplant(BSTNode<T> *oldNode, BSTNode<T> *newNode){
 }
 
 // Delete subtree function.
-// Description: This function deletes the subtree rooted at a given node.
-// Parameters: the root of the subtree to be deleted.
+// Description: This function deletes the subtree rooted at a given node. It walks down to a leaf, destroys it,
+// and continues from its parent, so it needs neither recursion nor a stack however deep the subtree is.
+// Parameters: the root of the subtree to be deleted, the allocator its nodes came from, and whether to give their
+// memory back (false when the whole pool is about to be released anyway).
 // Return value: NONE.
-template<class T, typename Comparator>
-void BST<T,Comparator>::deleteSubTree(BSTNode<T> *node){
-    if (node != NULL){
-        deleteSubTree(node->left);
-        deleteSubTree(node->right);
-        delete node;
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::deleteSubTree(BSTNode<T> *node, NodeAllocator &nodeAllocator, bool release){
+    BSTNode<T> *current = node;
+    while (current != NULL){
+        if (current->left != NULL){
+            current = current->left;
+        }
+        else if (current->right != NULL){
+            current = current->right;
+        }
+        else {
+            BSTNode<T> *parent = (current == node) ? NULL : current->parent;
+            if (parent != NULL){
+                if (parent->left == current){
+                    parent->left = NULL;
+                }
+                else {
+                    parent->right = NULL;
+                }
+            }
+            NodeAllocatorTraits::destroy(nodeAllocator, static_cast<Node *>(current));
+            if (release){
+                NodeAllocatorTraits::deallocate(nodeAllocator, static_cast<Node *>(current), 1);
+            }
+            current = parent;
+        }
     }
 }
 
+// Delete subtree function.
+// Description: This function deletes the subtree rooted at a given node, giving the memory back to the tree's
+// allocator.
+// Parameters: the root of the subtree to be deleted.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::deleteSubTree(BSTNode<T> *node){
+    deleteSubTree(node, allocator, true);
+}
+
 // Copy subtree function.
-// Description: This function performs a deep copy of the subtree rooted at a given node.
-// Parameters: the root of the subtree to be copied.
-// Return value: the root of the copied subtree.
-template<class T, typename Comparator>
-BSTNode<T>* BST<T,Comparator>::copySubTree(BSTNode<T> *node){
+// Description: This function performs a deep copy of the subtree rooted at a given node. It walks the original
+// with its parent pointers while the copy follows along, so it needs neither recursion nor a stack.
+// Parameters: the root of the subtree to be copied, the allocator for the new nodes.
+// Return value: the root of the copied subtree, with no parent.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::copySubTree(BSTNode<T> *node, NodeAllocator &nodeAllocator){
     if (node == NULL){
         return NULL;
     }
-    BSTNode<T> *newNode = new BSTNode<T>(node - >value);
-    newNode->left = copySubTree(node->left);
-    newNode->right = copySubTree(node->right);
+    BSTNode<T> *copyRoot = createNode(node->value, nodeAllocator);
+    BSTNode<T> *source = node;
+    BSTNode<T> *copy = copyRoot;
+    try {
+        while (true){
+            // The copy of a child exists once it has been visited, so it tells which way to go next.
+            if (source->left != NULL && copy->left == NULL){
+                copy->left = createNode(source->left->value, nodeAllocator);
+                copy->left->parent = copy;
+                source = source->left;
+                copy = copy->left;
+            }
+            else if (source->right != NULL && copy->right == NULL){
+                copy->right = createNode(source->right->value, nodeAllocator);
+                copy->right->parent = copy;
+                source = source->right;
+                copy = copy->right;
+            }
+            else {
+                // Both children are copied; the fields the policy keeps follow from theirs.
+                Node::update(copy);
+                if (source == node){
+                    return copyRoot;
+                }
+                source = source->parent;
+                copy = copy->parent;
+            }
+        }
+    } catch (...) {
+        deleteSubTree(copyRoot, nodeAllocator, true);
+        throw;
+    }
+}
+
+// Copy subtree function.
+// Description: This function performs a deep copy of the subtree rooted at a given node, using the tree's
+// allocator and as many threads as the tree's parallelism allows.
+// Parameters: the root of the subtree to be copied, the number of values in it.
+// Return value: the root of the copied subtree.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::copySubTree(BSTNode<T> *node, size_t count){
+    BSTNode<T> *copy = parallelCopySubTree(node, count, parallelism, allocator);
+    statistics.recordAllocations(count);
+    return copy;
+}
+
+// Child size function.
+// Description: This function returns the number of values below a child, exactly if the policy tracks sizes and
+// as half of the parent's otherwise.
+// Parameters: the child, the number of values below its parent.
+// Return value: the size, or its estimate.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+size_t BST<T,Comparator,Balance,Allocator,Stats>::childSize(BSTNode<T> *child, size_t parentSize){
+    if constexpr (Balance::tracksSize){
+        return Node::sizeOf(child);
+    }
+    return (child == NULL) ? 0 : parentSize / 2;
+}
+
+// Task allocator function.
+// Description: This function returns an allocator a forked task can use while this thread keeps using
+// nodeAllocator: a new pool for PoolAllocator, which is merged back with adoptTaskAllocator, or a copy of an
+// allocator that is always equal (such as std::allocator, which is thread-safe).
+// Parameters: the allocator of the forking thread.
+// Return value: the allocator for the task.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+typename BST<T,Comparator,Balance,Allocator,Stats>::NodeAllocator BST<T,Comparator,Balance,Allocator,Stats>::taskAllocator(const NodeAllocator &nodeAllocator){
+    if constexpr (IsPoolAllocator<NodeAllocator>::value){
+        return NodeAllocator();
+    }
+    else {
+        return nodeAllocator;
+    }
+}
+
+// Adopt task allocator function.
+// Description: This function lets nodeAllocator free the nodes a task allocated, once the task has finished.
+// Parameters: the allocator of the forking thread, the allocator of the task.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::adoptTaskAllocator(NodeAllocator &nodeAllocator, const NodeAllocator &task){
+    if constexpr (IsPoolAllocator<NodeAllocator>::value){
+        nodeAllocator.adopt(task);
+    }
+}
+
+// Parallel copy subtree function.
+// Description: This function copies a subtree, forking the copy of the left subtree to another thread whenever
+// threads remain and the subtree is larger than parallelThreshold. The halves run with separate allocators, so the
+// pool is never used by two threads at once. Smaller subtrees are copied by the iterative copySubTree.
+// Parameters: the root of the subtree to be copied, the number of values in it, the number of threads that may
+// work on it, the allocator for the new nodes.
+// Return value: the root of the copied subtree.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::parallelCopySubTree(BSTNode<T> *node, size_t count, unsigned threads, NodeAllocator &nodeAllocator){
+    if (!canFork || threads <= 1 || count < parallelThreshold || node == NULL){
+        return copySubTree(node, nodeAllocator);
+    }
+    NodeAllocator leftAllocator = taskAllocator(nodeAllocator);
+    future<BSTNode<T>*> leftCopy = async(launch::async, [node, count, threads, &leftAllocator](){
+        return parallelCopySubTree(node->left, childSize(node->left, count), threads / 2, leftAllocator);
+    });
+    BSTNode<T> *newNode = NULL;
+    BSTNode<T> *rightCopy = NULL;
+    try {
+        newNode = createNode(node->value, nodeAllocator);
+        rightCopy = parallelCopySubTree(node->right, childSize(node->right, count), threads - threads / 2, nodeAllocator);
+    } catch (...) {
+        try {
+            deleteSubTree(leftCopy.get(), leftAllocator, true);
+        } catch (...) {
+        }
+        if (newNode != NULL){
+            deleteSubTree(newNode, nodeAllocator, true);
+        }
+        throw;
+    }
+    try {
+        newNode->left = leftCopy.get();
+    } catch (...) {
+        deleteSubTree(rightCopy, nodeAllocator, true);
+        deleteSubTree(newNode, nodeAllocator, true);
+        throw;
+    }
+    adoptTaskAllocator(nodeAllocator, leftAllocator);
+    newNode->right = rightCopy;
+    if (newNode->left != NULL){
+        newNode->left->parent = newNode;
+    }
+    if (newNode->right != NULL){
+        newNode->right->parent = newNode;
+    }
+    Node::update(newNode);
     return newNode;
 }
 
+// Parallel delete subtree function.
+// Description: This function deletes a subtree, forking the left subtree to another thread whenever threads
+// remain and the subtree is larger than parallelThreshold. Memory is only given back if release is set, which
+// requires an allocator that several threads may use at once.
+// Parameters: the root of the subtree to be deleted, the number of values in it, the number of threads that may
+// work on it, the allocator its nodes came from, whether to give their memory back.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::parallelDeleteSubTree(BSTNode<T> *node, size_t count, unsigned threads, NodeAllocator &nodeAllocator, bool release){
+    if (threads <= 1 || count < parallelThreshold || node == NULL){
+        deleteSubTree(node, nodeAllocator, release);
+        return;
+    }
+    BSTNode<T> *left = node->left;
+    future<void> leftDelete = async(launch::async, [left, count, threads, &nodeAllocator, release](){
+        parallelDeleteSubTree(left, childSize(left, count), threads / 2, nodeAllocator, release);
+    });
+    parallelDeleteSubTree(node->right, childSize(node->right, count), threads - threads / 2, nodeAllocator, release);
+    leftDelete.get();
+    NodeAllocatorTraits::destroy(nodeAllocator, static_cast<Node *>(node));
+    if (release){
+        NodeAllocatorTraits::deallocate(nodeAllocator, static_cast<Node *>(node), 1);
+    }
+}
+
+// Parallel reduce function.
+// Description: This function folds a subtree in order, forking the left subtree to another thread whenever
+// threads remain and the subtree is larger than parallelThreshold.
+// Parameters: the root of the subtree, the number of values in it, the number of threads that may work on it,
+// the identity, the map and the combine functions (see reduce).
+// Return value: the folded value.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class Result, class Map, class Combine>
+Result BST<T,Comparator,Balance,Allocator,Stats>::parallelReduce(BSTNode<T> *node, size_t count, unsigned threads, const Result &identity, Map &map, Combine &combine){
+    if (node == NULL){
+        return identity;
+    }
+    if (threads <= 1 || count < parallelThreshold){
+        Result result = identity;
+        node->visitInOrder([&result, &map, &combine](const T &value){ result = combine(result, map(value)); });
+        return result;
+    }
+    future<Result> leftResult = async(launch::async, [node, count, threads, &identity, &map, &combine](){
+        return parallelReduce(node->left, childSize(node->left, count), threads / 2, identity, map, combine);
+    });
+    Result rightResult = parallelReduce(node->right, childSize(node->right, count), threads - threads / 2, identity, map, combine);
+    Result result = combine(leftResult.get(), map(node->value));
+    return combine(result, rightResult);
+}
+
 // Default constructor.
 // Description: This function constructs an empty BST.
 // Parameters: NONE.
 // Return value: NONE.
-template<class T, typename Comparator>
-BST<T,Comparator>::BST(Comparator comparator = Comparator()){
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BST<T,Comparator,Balance,Allocator,Stats>::BST(Comparator comparator, const Allocator &allocator) : allocator(allocator){
     root = NULL;
     numNodes = 0;
-    comparator = comparator;
+    this->comparator = comparator;
+    parallelism = defaultParallelism();
 }
 
 // Copy constructor.
 // Description: This function constructs a BST that is a deep copy of another BST.
 // Parameters: a given BST.
 // Return value: NONE.
-template<class T, typename Comparator>
-BST<T,Comparator>::BST(const BST<T, Comparator> &tree){
-    root = copySubTree(tree.root);
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BST<T,Comparator,Balance,Allocator,Stats>::BST(const BST<T, Comparator, Balance, Allocator, Stats> &tree){
+    parallelism = tree.parallelism;
+    root = copySubTree(tree.root, tree.numNodes);
     numNodes = tree.numNodes;
     comparator = tree.comparator;
 }
 
+// Move constructor.
+// Description: This function constructs a BST that takes over the nodes of another BST, leaving it empty. The
+// allocator moves with the nodes, which it has to free; the other BST gets a new one, so the two share no pool.
+// Parameters: a given BST.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BST<T,Comparator,Balance,Allocator,Stats>::BST(BST<T, Comparator, Balance, Allocator, Stats> &&tree) noexcept : allocator(std::move(tree.allocator)){
+    tree.allocator = NodeAllocator();
+    root = tree.root;
+    numNodes = tree.numNodes;
+    comparator = tree.comparator;
+    parallelism = tree.parallelism;
+    statistics = tree.statistics;
+    tree.statistics = Stats();
+    tree.root = NULL;
+    tree.numNodes = 0;
+}
+
+// Range constructor.
+// Description: This function constructs a balanced BST holding the values in [first, last).
+// Parameters: the range of values, the comparator, the allocator.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class InputIt>
+BST<T,Comparator,Balance,Allocator,Stats>::BST(InputIt first, InputIt last, Comparator comparator, const Allocator &allocator) : allocator(allocator){
+    root = NULL;
+    numNodes = 0;
+    this->comparator = comparator;
+    parallelism = defaultParallelism();
+    assign(first, last);
+}
+
+// List constructor.
+// Description: This function constructs a balanced BST from a list that is already in order, without comparisons.
+// Parameters: the sorted list, the comparator, the allocator.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class ListAllocator>
+BST<T,Comparator,Balance,Allocator,Stats>::BST(const DoublyLinkedList<T, ListAllocator> &sortedList, Comparator comparator, const Allocator &allocator) : allocator(allocator){
+    root = NULL;
+    numNodes = 0;
+    this->comparator = comparator;
+    parallelism = defaultParallelism();
+    assignSorted(sortedList.begin(), sortedList.end());
+}
+
 // Assignment operator.
 // Description: This function assigns a BST to another BST.
 // Parameters: a given BST.
 // Return value: a new BST which is exactly the same as the BST being assigned.
-template<class T, typename Comparator>
-BST<T, Comparator>& BST<T,Comparator>::operator=(const BST<T, Comparator> &tree){
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BST<T, Comparator, Balance, Allocator, Stats>& BST<T,Comparator,Balance,Allocator,Stats>::operator=(const BST<T, Comparator, Balance, Allocator, Stats> &tree){
     if (this != &tree){
+        statistics.recordDeallocations(numNodes);
         deleteSubTree(root);
-        root = copySubTree(tree.root);
+        root = NULL;
+        numNodes = 0;
+        root = copySubTree(tree.root, tree.numNodes);
         numNodes = tree.numNodes;
         comparator = tree.comparator;
     }
     return *this;
 }
 
+// Move assignment operator.
+// Description: This function swaps the contents of two BSTs, allocators included, so that each tree's nodes stay
+// with the allocator they came from; the old contents are destroyed with tree.
+// Parameters: a given BST.
+// Return value: this BST.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BST<T, Comparator, Balance, Allocator, Stats>& BST<T,Comparator,Balance,Allocator,Stats>::operator=(BST<T, Comparator, Balance, Allocator, Stats> &&tree) noexcept{
+    swap(root, tree.root);
+    swap(numNodes, tree.numNodes);
+    swap(comparator, tree.comparator);
+    swap(allocator, tree.allocator);
+    swap(parallelism, tree.parallelism);
+    swap(statistics, tree.statistics);
+    return *this;
+}
+
 // Checks if is empty.
 // Description: This function checks if the BST is empty.
 // Parameters: NONE.
 // Return value: true if the BST is empty, and false otherwise.
-template<class T, typename Comparator>
-bool BST<T,Comparator>::empty(void) const{
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+bool BST<T,Comparator,Balance,Allocator,Stats>::empty(void) const{
     return numNodes == 0;
 }
 
+// Get allocator.
+// Description: This function returns a copy of the allocator of the nodes.
+// Parameters: NONE.
+// Return value: the allocator, rebound to T.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+Allocator BST<T,Comparator,Balance,Allocator,Stats>::get_allocator(void) const{
+    return Allocator(allocator);
+}
+
 // Size.
 // Description: This function returns the number of nodes in the BST.
 // Parameters: NONE.
 // Return value: the number of nodes in the BST.
-template<class T, typename Comparator>
-size_t BST<T,Comparator>::size(void) const{
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+size_t BST<T,Comparator,Balance,Allocator,Stats>::size(void) const{
     return numNodes;
 }
 
+// Default parallelism function.
+// Description: This function returns the number of threads the copy, destruction and reduce walks may use by
+// default.
+// Parameters: NONE.
+// Return value: the number of hardware threads, at least 1.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+unsigned BST<T,Comparator,Balance,Allocator,Stats>::defaultParallelism(void){
+    unsigned threads = thread::hardware_concurrency();
+    return (threads == 0) ? 1 : threads;
+}
+
+// Set parallelism function.
+// Description: This function sets how many threads copying, destroying and reducing this BST may use.
+// Parameters: the number of threads; 0 or 1 keeps every walk on the calling thread.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::setParallelism(unsigned threads){
+    parallelism = (threads == 0) ? 1 : threads;
+}
+
+// Reduce function.
+// Description: This function folds the values in order: the result is
+// combine(...combine(combine(identity, map(v1)), map(v2))..., map(vn)). Large subtrees are folded on separate
+// threads and their results combined, so combine must be associative and identity neutral for it.
+// Parameters: the identity, the map function applied to each value, the combine function.
+// Return value: the folded value, identity if the tree is empty.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class Result, class Map, class Combine>
+Result BST<T,Comparator,Balance,Allocator,Stats>::reduce(Result identity, Map map, Combine combine) const{
+    return parallelReduce(root, numNodes, parallelism, identity, map, combine);
+}
+
 // Destructor.
-// Description: This function destroys the BST.
+// Description: This function destroys the BST. Large trees are torn down by several threads when their memory
+// does not have to be given back node by node (a pool no other container shares) or when the allocator is
+// thread-safe.
 // Parameters: NONE.
 // Return value: NONE.
-template<class T, typename Comparator>
-BST<T,Comparator>::~BST<T, Comparator>(void){
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BST<T,Comparator,Balance,Allocator,Stats>::~BST(void){
+    if constexpr (IsPoolAllocator<Allocator>::value){
+        if (allocator.uniquePool()){
+            // The blocks are released with the pool, so only the values need destroying, if anything.
+            if constexpr (!is_trivially_destructible<T>::value){
+                parallelDeleteSubTree(root, numNodes, parallelism, allocator, false);
+            }
+            return;
+        }
+    }
+    else if constexpr (NodeAllocatorTraits::is_always_equal::value){
+        parallelDeleteSubTree(root, numNodes, parallelism, allocator, true);
+        return;
+    }
     deleteSubTree(root);
 }
 
+// Build subtree function.
+// Description: This function builds a perfectly balanced subtree from the next count values of an in-order
+// sequence: the left half is built first, then the middle value becomes the root, then the right half.
+// Parameters: an iterator to the next value, advanced past the values used; the number of values to use.
+// Return value: the root of the new subtree, with no parent.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class ForwardIt>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::buildSubTree(ForwardIt &next, size_t count){
+    if (count == 0){
+        return NULL;
+    }
+    size_t leftCount = (count - 1) / 2;
+    BSTNode<T> *left = buildSubTree(next, leftCount);
+    BSTNode<T> *node = createNode(*next);
+    ++next;
+    node->left = left;
+    if (left != NULL){
+        left->parent = node;
+    }
+    node->right = buildSubTree(next, count - 1 - leftCount);
+    if (node->right != NULL){
+        node->right->parent = node;
+    }
+    Node::update(node);
+    return node;
+}
+
+// Build implicit subtree function.
+// Description: This function copies the implicit subtree rooted at index k of an array in Eytzinger order, whose
+// children are at 2k and 2k + 1, into nodes. The recursion is as deep as the complete tree, O(log n).
+// Parameters: the array, 1-based; the number of values in it; the index of the subtree root.
+// Return value: the root of the new subtree, with no parent, or NULL if k is past the end.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::buildImplicitSubTree(const T *values, size_t count, size_t k){
+    if (k > count){
+        return NULL;
+    }
+    BSTNode<T> *node = createNode(values[k]);
+    node->left = buildImplicitSubTree(values, count, 2 * k);
+    if (node->left != NULL){
+        node->left->parent = node;
+    }
+    node->right = buildImplicitSubTree(values, count, 2 * k + 1);
+    if (node->right != NULL){
+        node->right->parent = node;
+    }
+    Node::update(node);
+    return node;
+}
+
+// Assign function.
+// Description: This function replaces the contents of the BST with the values in a range. The values are sorted
+// first unless they are already in order, then a perfectly balanced tree is built in linear time.
+// Parameters: the range of values.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class InputIt>
+void BST<T,Comparator,Balance,Allocator,Stats>::assign(InputIt first, InputIt last){
+    vector<T> values(first, last);
+    bool sorted = true;
+    for (size_t i = 1; i < values.size() && sorted; i++){
+        sorted = compare(values[i - 1], values[i]);
+    }
+    if (!sorted){
+        // comparator(a, b) means a <= b, so a < b exactly when b <= a does not hold
+        stable_sort(values.begin(), values.end(), [this](const T &a, const T &b){ return !compare(b, a); });
+    }
+    assignSorted(values.begin(), values.end());
+}
+
+// Assign sorted function.
+// Description: This function replaces the contents of the BST with the values in a range that is already in order,
+// building a perfectly balanced tree in linear time without comparing values.
+// Parameters: the range of values, in order.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class ForwardIt>
+void BST<T,Comparator,Balance,Allocator,Stats>::assignSorted(ForwardIt first, ForwardIt last){
+    statistics.recordDeallocations(numNodes);
+    deleteSubTree(root);
+    root = NULL;
+    numNodes = 0;
+    size_t count = distance(first, last);
+    root = buildSubTree(first, count);
+    numNodes = count;
+}
+
+// Assign from a list.
+// Description: This function replaces the contents of the BST with the values of a list that is already in order,
+// e.g. the result of getInOrderTraversal, without comparing values.
+// Parameters: the sorted list.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class ListAllocator>
+void BST<T,Comparator,Balance,Allocator,Stats>::assign(const DoublyLinkedList<T, ListAllocator> &sortedList){
+    assignSorted(sortedList.begin(), sortedList.end());
+}
+
+// Link node function.
+// Description: This function attaches a new leaf to the tree and lets the balancing policy restore its shape.
+// Parameters: the parent of the new leaf (NULL if the tree is empty), the new leaf, which side of parent it goes on.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::linkNode(BSTNode<T> *parent, BSTNode<T> *node, bool asLeftChild){
+    node->parent = parent;
+    if (parent == NULL) {
+        root = node;
+    } else if (asLeftChild) {
+        parent->left = node;
+    } else {
+        parent->right = node;
+    }
+    numNodes++;
+    if constexpr (Balance::tracksSize) {
+        for (BSTNode<T> *ancestor = parent; ancestor != NULL; ancestor = ancestor->parent) {
+            static_cast<Node *>(ancestor)->subtreeSize++;
+        }
+    }
+    Balance::template afterInsert<Node>(root, node);
+}
+
 // Insert function.
 // Description: This function inserts a value into the BST.
 // Parameters: a value to be inserted.
 // Return value: the node that was inserted.
-template<class T, typename Comparator>
-BSTNode<T>* BST<T,Comparator>::insert(T value){
-    BSTNode<T>* newNode = new BSTNode<T>(value);
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::insert(const T &value){
+    BSTNode<T>* newNode = createNode(value);
+    insertNode(newNode);
+    return newNode;
+}
+
+// Insert node function.
+// Description: This function links a node that holds no links yet, e.g. a new one, where its value belongs.
+// Parameters: the node, with no parent or children.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::insertNode(BSTNode<T> *newNode){
     BSTNode<T>* parent = NULL;
     BSTNode<T>* current = root;
+    bool goLeft = false;
+    size_t depth = 0;
 
     while (current != NULL) {
         parent = current;
-        if (comparator(value, current->value)) {
+        depth++;
+        goLeft = compare(newNode->value, current->value);
+        if (goLeft) {
             current = current->left;
         } else {
             current = current->right;
         }
     }
 
-    newNode->parent = parent;
-    if (parent == NULL) {
-        root = newNode;
-    } else if (comparator(value, parent->value)) {
-        parent->left = newNode;
-    } else {
-        parent->right = newNode;
-    }
+    linkNode(parent, newNode, goLeft);
+    statistics.recordInsert(depth);
+}
 
-    numNodes++;
+// Insert with hint function.
+// Description: This function inserts a value into the BST, searching for its place from a node close to it.
+// Parameters: a node of the tree near the value, or NULL; a value to be inserted.
+// Return value: the node that was inserted.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::insert(BSTNode<T> *hint, const T &value){
+    BSTNode<T>* newNode = createNode(value);
+    insertNodeNear(hint, newNode);
+    return newNode;
+}
+
+// Emplace with hint function.
+// Description: This function constructs a value in a new node and inserts it, searching for its place from a
+// node close to it.
+// Parameters: a node of the tree near the value, or NULL; the arguments the value is constructed from.
+// Return value: the node that was inserted.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class... Args>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::emplace_hint(BSTNode<T> *hint, Args&&... args){
+    BSTNode<T>* newNode = emplaceNode(std::forward<Args>(args)...);
+    insertNodeNear(hint, newNode);
     return newNode;
 }
 
+// Insert node near function.
+// Description: This function links a node that holds no links yet where its value belongs, as insertNode does,
+// but starts from hint. The value goes on one side of hint; climbing from hint, only the ancestors reached from
+// that side bound the subtree on that side, so only they are compared. The climb stops at the first one that
+// leaves the value inside the subtree below it, and the usual descent continues from there.
+// Parameters: a node of the tree, or NULL to search from the root; the node, with no parent or children.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::insertNodeNear(BSTNode<T> *hint, BSTNode<T> *newNode){
+    if (hint == NULL) {
+        insertNode(newNode);
+        return;
+    }
+    const T &value = newNode->value;
+    // the value goes left of hint (before it in order) if value <= hint
+    bool before = compare(value, hint->value);
+    size_t depth = 1;
+
+    // subtree to descend from; the value belongs on the before side of its root
+    BSTNode<T>* top = hint;
+    for (BSTNode<T>* child = hint, *ancestor = hint->parent; ancestor != NULL; child = ancestor, ancestor = ancestor->parent) {
+        bool bounding = before ? (ancestor->right == child) : (ancestor->left == child);
+        if (!bounding) {
+            continue;
+        }
+        depth++;
+        // before: stop if ancestor < value; after: stop if value <= ancestor
+        if (compare(value, ancestor->value) != before) {
+            break;
+        }
+        top = ancestor;
+    }
+
+    BSTNode<T>* parent = top;
+    bool goLeft = before;
+    BSTNode<T>* current = before ? top->left : top->right;
+    while (current != NULL) {
+        parent = current;
+        depth++;
+        goLeft = compare(value, current->value);
+        if (goLeft) {
+            current = current->left;
+        } else {
+            current = current->right;
+        }
+    }
+
+    linkNode(parent, newNode, goLeft);
+    statistics.recordInsert(depth);
+}
+
 // Delete function.
 // Description: This function deletes a node from the BST.
 // Parameters: the node to be deleted.
 // Return value: NONE.
 // throws std::invalid_argument if nodeToDelete == nullptr.
 // throws std::length_error if tree is empty.
-template<class T, typename Comparator>
-void BST<T,Comparator>::erase(BSTNode<T>* nodeToDelete){
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::erase(BSTNode<T>* nodeToDelete){
     if (nodeToDelete == NULL){
         throw invalid_argument("Can not delete a null node");
     }
     if (numNodes == 0){
         throw length_error("Tree is empty");
     }
+    // lowest node whose subtree loses a node, where the balancing policy starts its repair
+    BSTNode<T> *changed = nodeToDelete->parent;
+    statistics.recordErase(nodeToDelete->left != NULL && nodeToDelete->right != NULL);
     if (nodeToDelete->left == NULL){
         transplant(nodeToDelete,nodeToDelete->right);
     }
@@ -188,8 +799,10 @@ void BST<T,Comparator>::erase(BSTNode<T>* nodeToDelete){
         transplant(nodeToDelete,nodeToDelete->left);
     }
     else{
-        BSTNode<T> *successor = treeMin();
+        BSTNode<T> *successor = nodeToDelete->right->treeMin();
+        changed = successor;
         if (successor != nodeToDelete->right){
+            changed = successor->parent;
             transplant(successor,successor->right);
             successor->right = nodeToDelete->right;
             successor->right->parent = successor;
@@ -197,27 +810,222 @@ void BST<T,Comparator>::erase(BSTNode<T>* nodeToDelete){
         transplant(nodeToDelete,successor);
         successor->left = nodeToDelete->left;
         successor->left->parent = successor;
+        if constexpr (Balance::tracksHeight) {
+            static_cast<Node *>(successor)->height = static_cast<Node *>(nodeToDelete)->height;
+        }
     }
-    delete nodeToDelete;
+    destroyNode(nodeToDelete);
     numNodes --;
+    if constexpr (Balance::tracksSize) {
+        // only the sizes: the policy finds the heights as they were before the erase
+        for (BSTNode<T> *ancestor = changed; ancestor != NULL; ancestor = ancestor->parent) {
+            static_cast<Node *>(ancestor)->subtreeSize = 1 + Node::sizeOf(ancestor->left) + Node::sizeOf(ancestor->right);
+        }
+    }
+    Balance::template afterErase<Node>(root, changed);
 }
 
 // Search function.
-// Description: This function searches for a value in the BST.
+// Description: This function searches for a value in the BST. It descends like lower_bound, with one comparison
+// per level, and checks for equality once at the end.
 // Parameters: a value to be searched.
-// Return value: the node that contains the value, or NULL if the value is not found.
-template<class T, typename Comparator>
-BSTNode<T>* BST<T,Comparator>::search(T value) const{
+// Return value: the node that contains the value (the first one in order if there are several), or NULL if the
+// value is not found.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::search(const T &value) const{
+    BSTNode<T> *candidate = lowerBoundNode(value, false);
+    // candidate is not less than value, so it is equal if it is also <= value
+    if (candidate != NULL && compare(candidate->value, value)){
+        return candidate;
+    }
+    return NULL;
+}
+
+// Batched search function.
+// Description: This function runs the searches in groups of up to 16. Every search of a group is a lane with its
+// own current node and candidate; each round moves every unfinished lane one level down and prefetches the child
+// it lands on, which the lane only reads a round later, after the other lanes have had their turn. The lookups of
+// one group are independent, so their cache misses are in flight together instead of one after another. The
+// balancing policy is told about the accessed nodes after the group is done, since splaying in the middle would
+// pull nodes out from under the other lanes.
+// Parameters: the values to search, how many there are, where to write the nodes found.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::search_batch(const T *values, size_t count, BSTNode<T> **results) const{
+    const size_t lanes = 16;
+    BSTNode<T> *current[lanes];
+    BSTNode<T> *last[lanes];
+    size_t depth[lanes];
+    for (size_t first = 0; first < count; first += lanes){
+        size_t width = min(lanes, count - first);
+        const T *keys = values + first;
+        BSTNode<T> **found = results + first;
+        for (size_t k = 0; k < width; k++){
+            current[k] = root;
+            last[k] = NULL;
+            found[k] = NULL;
+            depth[k] = 0;
+        }
+        size_t active = (root != NULL) ? width : 0;
+        while (active > 0){
+            for (size_t k = 0; k < width; k++){
+                BSTNode<T> *node = current[k];
+                if (node == NULL){
+                    continue;
+                }
+                depth[k]++;
+                last[k] = node;
+                if (compare(keys[k], node->value)){
+                    found[k] = node;
+                    node = node->left;
+                }
+                else{
+                    node = node->right;
+                }
+                if (node == NULL){
+                    active--;
+                }
+#if defined(__GNUC__)
+                else{
+                    __builtin_prefetch(node);
+                }
+#endif
+                current[k] = node;
+            }
+        }
+        for (size_t k = 0; k < width; k++){
+            statistics.recordSearch(depth[k]);
+            // found[k] is not less than the key, so it is equal if it is also <= the key
+            if (found[k] != NULL && !compare(found[k]->value, keys[k])){
+                found[k] = NULL;
+            }
+            if (last[k] != NULL){
+                Balance::template afterAccess<Node>(root, last[k]);
+            }
+        }
+    }
+}
+
+// Batched contains function.
+// Description: This function runs search_batch over slices of the values and records which searches found one.
+// Parameters: the values to search, how many there are, where to write the answers.
+// Return value: the number of values found.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+size_t BST<T,Comparator,Balance,Allocator,Stats>::contains_batch(const T *values, size_t count, bool *results) const{
+    const size_t slice = 256;
+    BSTNode<T> *found[slice];
+    size_t numFound = 0;
+    for (size_t first = 0; first < count; first += slice){
+        size_t width = min(slice, count - first);
+        search_batch(values + first, width, found);
+        for (size_t k = 0; k < width; k++){
+            results[first + k] = (found[k] != NULL);
+            numFound += results[first + k];
+        }
+    }
+    return numFound;
+}
+
+#if __cplusplus >= 202002L
+// Batched search function, over spans.
+// Description: This function checks that every value has a result slot and calls search_batch.
+// Parameters: the values to search, where to write the nodes found.
+// Return value: NONE.
+// throws std::invalid_argument if results is shorter than values.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::search_batch(span<const T> values, span<BSTNode<T>*> results) const{
+    if (results.size() < values.size()){
+        throw invalid_argument("Not enough room for the results");
+    }
+    search_batch(values.data(), values.size(), results.data());
+}
+
+// Batched contains function, over spans.
+// Description: This function checks that every value has a result slot and calls contains_batch.
+// Parameters: the values to search, where to write the answers.
+// Return value: the number of values found.
+// throws std::invalid_argument if results is shorter than values.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+size_t BST<T,Comparator,Balance,Allocator,Stats>::contains_batch(span<const T> values, span<bool> results) const{
+    if (results.size() < values.size()){
+        throw invalid_argument("Not enough room for the results");
+    }
+    return contains_batch(values.data(), values.size(), results.data());
+}
+#endif
+
+// Lower bound node function.
+// Description: This function descends from the root, remembering the last node where it turned left. The last
+// node on the path is handed to the balancing policy as accessed.
+// Parameters: a value; whether to skip the values equal to it.
+// Return value: the first node not less than value (greater than value if strict), or NULL if there is none.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::lowerBoundNode(const T &value, bool strict) const{
+    BSTNode<T> *candidate = NULL;
+    BSTNode<T> *last = NULL;
     BSTNode<T> *current = root;
-    while (current && current->value!= value){
-        if (comparator(value,current->value)){
+    size_t depth = 0;
+    while (current != NULL){
+        depth++;
+        last = current;
+        // value <= current for lower_bound, and not current <= value (that is, value < current) for upper_bound
+        bool goLeft = strict ? !compare(current->value, value) : compare(value, current->value);
+        if (goLeft){
+            candidate = current;
             current = current->left;
         }
         else{
             current = current->right;
         }
     }
-    return current;
+    statistics.recordSearch(depth);
+    if (last != NULL){
+        Balance::template afterAccess<Node>(root, last);
+    }
+    return candidate;
+}
+
+// Lower bound function.
+// Description: This function finds the first value that is not less than the given one.
+// Parameters: a value.
+// Return value: an iterator to that value, or end() if every value is less than the given one.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+typename BST<T,Comparator,Balance,Allocator,Stats>::iterator BST<T,Comparator,Balance,Allocator,Stats>::lower_bound(const T &value) const{
+    return iterator(lowerBoundNode(value, false), this);
+}
+
+// Upper bound function.
+// Description: This function finds the first value that is greater than the given one.
+// Parameters: a value.
+// Return value: an iterator to that value, or end() if no value is greater than the given one.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+typename BST<T,Comparator,Balance,Allocator,Stats>::iterator BST<T,Comparator,Balance,Allocator,Stats>::upper_bound(const T &value) const{
+    return iterator(lowerBoundNode(value, true), this);
+}
+
+// Equal range function.
+// Description: This function finds the range of values equal to the given one.
+// Parameters: a value.
+// Return value: the pair (lower_bound(value), upper_bound(value)); both are equal if the value is not in the tree.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+pair<typename BST<T,Comparator,Balance,Allocator,Stats>::iterator, typename BST<T,Comparator,Balance,Allocator,Stats>::iterator>
+BST<T,Comparator,Balance,Allocator,Stats>::equal_range(const T &value) const{
+    return make_pair(lower_bound(value), upper_bound(value));
+}
+
+// Range visitor.
+// Description: This function calls visit on every value v with lo <= v <= hi, in order. It descends once to the
+// lower bound of lo and then follows successors until it passes hi.
+// Parameters: the bounds of the range, both inclusive; a callable taking a const reference to a value.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class Visitor>
+void BST<T,Comparator,Balance,Allocator,Stats>::visitRange(const T &lo, const T &hi, Visitor visit) const{
+    BSTNode<T> *current = lowerBoundNode(lo, false);
+    while (current != NULL && compare(current->value, hi)){
+        visit(current->value);
+        current = current->successor();
+    }
 }
 
 // Min function.
@@ -225,12 +1033,14 @@ BSTNode<T>* BST<T,Comparator>::search(T value) const{
 // Parameters: NONE.
 // Return value: the node with the minimum value in the BST.
 // throws std::length_error if tree is empty.
-template<class T, typename Comparator>
-BSTNode<T>* BST<T,Comparator>::treeMin(void) const{
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::treeMin(void) const{
     if (numNodes == 0){
         throw length_error("Tree is empty!");
     }
-    return root->treeMin();
+    BSTNode<T> *node = root->treeMin();
+    Balance::template afterAccess<Node>(root, node);
+    return node;
 }
 
 // Max function.
@@ -238,12 +1048,14 @@ BSTNode<T>* BST<T,Comparator>::treeMin(void) const{
 // Parameters: NONE.
 // Return value: the node with the maximum value in the BST.
 // throws std::length_error if tree is empty.
-template<class T, typename Comparator>
-BSTNode<T>* BST<T,Comparator>::treeMax(void) const{
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::treeMax(void) const{
     if (numNodes == 0){
         throw length_error("Tree is empty!");
     }
-    return root->treeMax();
+    BSTNode<T> *node = root->treeMax();
+    Balance::template afterAccess<Node>(root, node);
+    return node;
 }
 
 // Preorder traversal.
@@ -251,8 +1063,8 @@ BSTNode<T>* BST<T,Comparator>::treeMax(void) const{
 // Parameters: NONE.
 // Return value: a DoublyLinkedList of the values in the BST in preorder.
 // throws std::length_error if tree is empty.
-template<class T, typename Comparator>
-DoublyLinkedList<T> BST<T,Comparator>::getPreOrderTraversal(void) const{
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+DoublyLinkedList<T> BST<T,Comparator,Balance,Allocator,Stats>::getPreOrderTraversal(void) const{
     if (numNodes == 0){
         throw length_error("Tree is empty!");
     }
@@ -264,8 +1076,8 @@ DoublyLinkedList<T> BST<T,Comparator>::getPreOrderTraversal(void) const{
 // Parameters: NONE.
 // Return value: a DoublyLinkedList of the values in the BST in inorder.
 // throws std::length_error if tree is empty.
-template<class T, typename Comparator>
-DoublyLinkedList<T> BST<T,Comparator>::getInOrderTraversal(void) const{
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+DoublyLinkedList<T> BST<T,Comparator,Balance,Allocator,Stats>::getInOrderTraversal(void) const{
     if (numNodes == 0){
         throw length_error("Tree is empty!");
     }
@@ -277,10 +1089,643 @@ DoublyLinkedList<T> BST<T,Comparator>::getInOrderTraversal(void) const{
 // Parameters: NONE.
 // Return value: a DoublyLinkedList of the values in the BST in postorder.
 // throws std::length_error if tree is empty.
-template<class T, typename Comparator>
-DoublyLinkedList<T> BST<T,Comparator>::getPostOrderTraversal(void) const{
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+DoublyLinkedList<T> BST<T,Comparator,Balance,Allocator,Stats>::getPostOrderTraversal(void) const{
     if (numNodes == 0){
         throw length_error("Tree is empty!");
     }
     return root->getPostOrderTraversal();
-}
\ No newline at end of file
+}
+
+// Preorder visitor.
+// Description: This function calls visit on every value in the BST in preorder, without allocating.
+// Parameters: a callable taking a const reference to a value.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class Visitor>
+void BST<T,Comparator,Balance,Allocator,Stats>::visitPreOrder(Visitor visit) const{
+    if (root != NULL){
+        root->visitPreOrder(visit);
+    }
+}
+
+// Inorder visitor.
+// Description: This function calls visit on every value in the BST in inorder, without allocating.
+// Parameters: a callable taking a const reference to a value.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class Visitor>
+void BST<T,Comparator,Balance,Allocator,Stats>::visitInOrder(Visitor visit) const{
+    if (root != NULL){
+        root->visitInOrder(visit);
+    }
+}
+
+// Postorder visitor.
+// Description: This function calls visit on every value in the BST in postorder, without allocating.
+// Parameters: a callable taking a const reference to a value.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+template<class Visitor>
+void BST<T,Comparator,Balance,Allocator,Stats>::visitPostOrder(Visitor visit) const{
+    if (root != NULL){
+        root->visitPostOrder(visit);
+    }
+}
+
+// Count below function.
+// Description: This function counts the values less than (or, if inclusive, less than or equal to) a value,
+// adding up the sizes of the left subtrees passed on the way down.
+// Parameters: the value, whether values equal to it are counted.
+// Return value: the number of values below the given one.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+size_t BST<T,Comparator,Balance,Allocator,Stats>::countBelow(const T &value, bool inclusive) const{
+    size_t count = 0;
+    BSTNode<T> *current = root;
+    while (current != NULL){
+        // current <= value when inclusive, current < value (that is, not value <= current) otherwise
+        bool below = inclusive ? compare(current->value, value) : !compare(value, current->value);
+        if (below){
+            count += 1 + Node::sizeOf(current->left);
+            current = current->right;
+        }
+        else{
+            current = current->left;
+        }
+    }
+    return count;
+}
+
+// Select function.
+// Description: This function finds the k-th smallest value, counting from 0, using the subtree sizes.
+// Parameters: the rank k.
+// Return value: the node holding the k-th smallest value.
+// throws std::out_of_range if k >= size().
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::select(size_t k) const{
+    static_assert(Balance::tracksSize, "select needs a policy that tracks sizes, e.g. OrderStatistics<>");
+    if (k >= numNodes){
+        throw out_of_range("Rank is out of range");
+    }
+    BSTNode<T> *current = root;
+    while (true){
+        size_t leftSize = Node::sizeOf(current->left);
+        if (k < leftSize){
+            current = current->left;
+        }
+        else if (k == leftSize){
+            return current;
+        }
+        else{
+            k -= leftSize + 1;
+            current = current->right;
+        }
+    }
+}
+
+// Rank function.
+// Description: This function counts the values that are less than the given one.
+// Parameters: a value.
+// Return value: the number of values less than the given one, which is the rank it has or would have.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+size_t BST<T,Comparator,Balance,Allocator,Stats>::rank(const T &value) const{
+    static_assert(Balance::tracksSize, "rank needs a policy that tracks sizes, e.g. OrderStatistics<>");
+    return countBelow(value, false);
+}
+
+// Count range function.
+// Description: This function counts the values v with lo <= v <= hi.
+// Parameters: the bounds of the range, both inclusive.
+// Return value: the number of values in the range, 0 if hi < lo.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+size_t BST<T,Comparator,Balance,Allocator,Stats>::count_range(const T &lo, const T &hi) const{
+    static_assert(Balance::tracksSize, "count_range needs a policy that tracks sizes, e.g. OrderStatistics<>");
+    size_t upTo = countBelow(hi, true);
+    size_t below = countBelow(lo, false);
+    return (upTo > below) ? upTo - below : 0;
+}
+
+// Freeze function.
+// Description: This function copies the values of the BST into a read-only snapshot in Eytzinger layout.
+// Parameters: NONE.
+// Return value: the snapshot.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+FrozenBST<T, Comparator> BST<T,Comparator,Balance,Allocator,Stats>::freeze(void) const{
+    vector<T> values;
+    values.reserve(numNodes);
+    visitInOrder([&values](const T &value){ values.push_back(value); });
+    return FrozenBST<T, Comparator>(values.begin(), values.end(), comparator);
+}
+
+// Snapshot function.
+// Description: This function copies the values of the BST into a balanced persistent tree, in linear time.
+// Parameters: NONE.
+// Return value: the persistent tree.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+PersistentBST<T, Comparator> BST<T,Comparator,Balance,Allocator,Stats>::snapshot(void) const{
+    vector<T> values;
+    values.reserve(numNodes);
+    visitInOrder([&values](const T &value){ values.push_back(value); });
+    return PersistentBST<T, Comparator>(values.begin(), values.end(), comparator);
+}
+
+// Save function.
+// Description: This function lays the values out as a frozen snapshot and writes it to a file: a header, then the
+// values in Eytzinger order, which is the level order of a complete tree.
+// Parameters: the path of the file.
+// Return value: NONE.
+// throws std::runtime_error if the file cannot be written.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::save(const string &path) const{
+    freeze().save(path);
+}
+
+// Load function.
+// Description: This function reads a snapshot file and rebuilds the tree in the shape stored in it. The file holds
+// a complete tree, which is balanced for every policy, so the nodes are linked as they are read, without a single
+// comparison.
+// Parameters: the path of the file.
+// Return value: NONE.
+// throws std::runtime_error if the file cannot be read or is not a snapshot of T.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::load(const string &path){
+    static_assert(is_trivially_copyable<T>::value, "only trivially copyable values can be loaded");
+    ifstream file(path.c_str(), ios::binary | ios::ate);
+    if (!file){
+        throw runtime_error("Could not open " + path);
+    }
+    uint64_t fileSize = file.tellg();
+    file.seekg(0);
+    FrozenSnapshotHeader header;
+    if (fileSize < sizeof(header) || !file.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || !header.describes(sizeof(T), fileSize - sizeof(header))){
+        throw runtime_error(path + " is not a snapshot of this type");
+    }
+    // The array is read into raw storage, as MappedBST reads it from the mapping, so T needs no default
+    // constructor; its size was checked against the file above.
+    size_t stored = (header.count == 0) ? 0 : header.count + 1;
+    std::allocator<T> storage;
+    T *values = storage.allocate(stored + 1);
+    if (!file.read(reinterpret_cast<char*>(values), stored * sizeof(T))){
+        storage.deallocate(values, stored + 1);
+        throw runtime_error("Could not read " + path);
+    }
+    statistics.recordDeallocations(numNodes);
+    deleteSubTree(root);
+    root = NULL;
+    numNodes = 0;
+    try{
+        root = buildImplicitSubTree(values, header.count, 1);
+    }
+    catch (...){
+        storage.deallocate(values, stored + 1);
+        throw;
+    }
+    numNodes = header.count;
+    storage.deallocate(values, stored + 1);
+}
+
+// Stats function.
+// Description: This function returns the counters collected so far by the statistics policy, e.g. to export them
+// as metrics; comparisons / searches is the average cost of a search.
+// Parameters: NONE.
+// Return value: the policy's snapshot, empty with NoStats.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+typename Stats::Snapshot BST<T,Comparator,Balance,Allocator,Stats>::stats(void) const{
+    return statistics.snapshot();
+}
+
+// To vine function.
+// Description: This function flattens a subtree into the chain of its nodes in order, linked through their right
+// children, by rotating every left child up as the walk meets it (the first phase of Day-Stout-Warren). It runs in
+// linear time and allocates nothing; parents, heights and sizes are left stale until the chain is rebuilt.
+// Parameters: the root of the subtree.
+// Return value: the first node of the chain, NULL if the subtree is empty.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::toVine(BSTNode<T> *node){
+    BSTNode<T> *head = NULL;
+    BSTNode<T> *tail = NULL;
+    BSTNode<T> *current = node;
+    while (current != NULL){
+        if (current->left != NULL){
+            BSTNode<T> *left = current->left;
+            current->left = left->right;
+            left->right = current;
+            current = left;
+        }
+        else {
+            appendToVine(head, tail, current);
+            current = current->right;
+        }
+    }
+    return head;
+}
+
+// Append to vine function.
+// Description: This function adds a node at the end of a chain of nodes linked through their right children.
+// Parameters: the first and last node of the chain (both NULL if it is empty), the node to append; its right child
+// is left as it is until the next append.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::appendToVine(BSTNode<T> *&head, BSTNode<T> *&tail, BSTNode<T> *node){
+    if (tail == NULL){
+        head = node;
+    }
+    else {
+        tail->right = node;
+    }
+    tail = node;
+}
+
+// From vine function.
+// Description: This function relinks the next count nodes of a chain into a perfectly balanced subtree, the same
+// shape buildSubTree gives, without allocating or comparing.
+// Parameters: the next node of the chain, advanced past the nodes used; the number of nodes to use.
+// Return value: the root of the new subtree, with no parent.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::fromVine(BSTNode<T> *&next, size_t count){
+    if (count == 0){
+        return NULL;
+    }
+    size_t leftCount = (count - 1) / 2;
+    BSTNode<T> *left = fromVine(next, leftCount);
+    BSTNode<T> *node = next;
+    next = next->right;
+    node->parent = NULL;
+    node->left = left;
+    if (left != NULL){
+        left->parent = node;
+    }
+    node->right = fromVine(next, count - 1 - leftCount);
+    if (node->right != NULL){
+        node->right->parent = node;
+    }
+    Node::update(node);
+    return node;
+}
+
+// Detach function.
+// Description: This function clears the links of a node taken from a chain, so that it can be inserted again.
+// Parameters: the node.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::detach(BSTNode<T> *node){
+    node->parent = NULL;
+    node->left = NULL;
+    node->right = NULL;
+    Node::update(node);
+}
+
+// Can adopt nodes function.
+// Description: This function checks whether this BST's allocator can free the nodes of another BST, letting a
+// PoolAllocator adopt the other pool if needed (see DoublyLinkedList::canAdoptNodes).
+// Parameters: the other BST.
+// Return value: true if nodes can move between the trees, false if values must be copied instead.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+bool BST<T,Comparator,Balance,Allocator,Stats>::canAdoptNodes(BST<T, Comparator, Balance, Allocator, Stats> &tree){
+    if (allocator == tree.allocator){
+        return true;
+    }
+    if constexpr (IsPoolAllocator<NodeAllocator>::value){
+        allocator.adopt(tree.allocator);
+        return true;
+    }
+    return false;
+}
+
+// Take node function.
+// Description: This function hands a node of another BST over to this one, copying its value into a new node if
+// the allocators cannot share nodes.
+// Parameters: the node, the BST it came from, whether nodes can move between the trees.
+// Return value: a node this BST can free.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BSTNode<T>* BST<T,Comparator,Balance,Allocator,Stats>::takeNode(BSTNode<T> *node, BST<T, Comparator, Balance, Allocator, Stats> &tree, bool adopted){
+    if (adopted){
+        return node;
+    }
+    BSTNode<T> *copy = createNode(node->value);
+    tree.destroyNode(node);
+    return copy;
+}
+
+// Fewer than linear function.
+// Description: This function tells whether inserting or erasing m values one at a time, O(m log n), is cheaper
+// than the O(n + m) merge of the two chains.
+// Parameters: n, the size of the larger tree, and m.
+// Return value: true if m log n < n + m.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+bool BST<T,Comparator,Balance,Allocator,Stats>::fewerThanLinear(size_t n, size_t m){
+    size_t logN = 0;
+    while ((n >> logN) > 1){
+        logN++;
+    }
+    return m * (logN + 1) < n + m;
+}
+
+// Combine function.
+// Description: This function walks the chains of both trees side by side, as std::merge, std::set_union,
+// std::set_intersection and std::set_difference do, keeping or freeing each node, and rebuilds a balanced tree
+// from the nodes kept. Equal values pair up one to one, so duplicates follow the standard multiset rules. When
+// other is small and the operation allows it, its values are instead inserted or erased one at a time.
+// Parameters: the other BST, emptied; the operation.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::combine(BST<T, Comparator, Balance, Allocator, Stats> &tree, SetOperation operation){
+    if (&tree == this){
+        if (operation == SubtractValues){
+            statistics.recordDeallocations(numNodes);
+            deleteSubTree(root);
+            root = NULL;
+            numNodes = 0;
+        }
+        else if (operation == MergeValues){
+            BST<T, Comparator, Balance, Allocator, Stats> copy(*this);
+            combine(copy, MergeValues);
+        }
+        return;
+    }
+    bool adopted = canAdoptNodes(tree);
+    BSTNode<T> *other = toVine(tree.root);
+    size_t otherCount = tree.numNodes;
+    tree.root = NULL;
+    tree.numNodes = 0;
+
+    if (operation != IntersectValues && adopted && fewerThanLinear(numNodes, otherCount)){
+        while (other != NULL){
+            // Handle a run of equal values of other at once.
+            BSTNode<T> *runEnd = other;
+            size_t runLength = 1;
+            while (runEnd->right != NULL && compare(runEnd->right->value, other->value)){
+                runEnd = runEnd->right;
+                runLength++;
+            }
+            BSTNode<T> *next = runEnd->right;
+            size_t matched = 0;
+            if (operation != MergeValues){
+                BSTNode<T> *equal = lowerBoundNode(other->value, false);
+                while (matched < runLength && equal != NULL && compare(equal->value, other->value)){
+                    BSTNode<T> *following = equal->successor();
+                    if (operation == SubtractValues){
+                        erase(equal);
+                    }
+                    matched++;
+                    equal = following;
+                }
+            }
+            for (size_t i = 0; i < runLength; i++){
+                BSTNode<T> *node = other;
+                other = other->right;
+                if (operation != SubtractValues && i >= matched){
+                    detach(node);
+                    insertNode(node);
+                }
+                else {
+                    destroyNode(node);
+                }
+            }
+            other = next;
+        }
+        return;
+    }
+
+    BSTNode<T> *mine = toVine(root);
+    root = NULL;
+    numNodes = 0;
+    BSTNode<T> *head = NULL;
+    BSTNode<T> *tail = NULL;
+    size_t count = 0;
+    bool keepMine = (operation != IntersectValues);
+    bool keepOther = (operation == MergeValues || operation == UniteValues);
+    try {
+        while (mine != NULL && other != NULL){
+            BSTNode<T> *next;
+            if (operation == MergeValues ? compare(mine->value, other->value) : !compare(other->value, mine->value)){
+                // mine goes first: it is less than other, or equal and merging keeps this tree's values first
+                next = mine->right;
+                if (keepMine){
+                    appendToVine(head, tail, mine);
+                    count++;
+                }
+                else {
+                    destroyNode(mine);
+                }
+                mine = next;
+            }
+            else if (operation == MergeValues || !compare(mine->value, other->value)){
+                next = other->right;
+                if (keepOther){
+                    appendToVine(head, tail, takeNode(other, tree, adopted));
+                    count++;
+                }
+                else {
+                    tree.destroyNode(other);
+                }
+                other = next;
+            }
+            else {
+                // equal values pair up: one is kept for union and intersection, none for difference
+                next = mine->right;
+                if (operation != SubtractValues){
+                    appendToVine(head, tail, mine);
+                    count++;
+                }
+                else {
+                    destroyNode(mine);
+                }
+                mine = next;
+                next = other->right;
+                if (adopted){
+                    destroyNode(other);
+                }
+                else {
+                    tree.destroyNode(other);
+                }
+                other = next;
+            }
+        }
+        while (mine != NULL){
+            BSTNode<T> *next = mine->right;
+            if (keepMine){
+                appendToVine(head, tail, mine);
+                count++;
+            }
+            else {
+                destroyNode(mine);
+            }
+            mine = next;
+        }
+        while (other != NULL){
+            BSTNode<T> *next = other->right;
+            if (keepOther){
+                appendToVine(head, tail, takeNode(other, tree, adopted));
+                count++;
+            }
+            else if (adopted){
+                destroyNode(other);
+            }
+            else {
+                tree.destroyNode(other);
+            }
+            other = next;
+        }
+    } catch (...) {
+        // Only copying a value of other can throw. Keep what was combined so far and this tree's remaining nodes,
+        // which all come after it in order, and free the rest of other.
+        while (mine != NULL){
+            BSTNode<T> *next = mine->right;
+            appendToVine(head, tail, mine);
+            count++;
+            mine = next;
+        }
+        while (other != NULL){
+            BSTNode<T> *next = other->right;
+            tree.destroyNode(other);
+            other = next;
+        }
+        root = fromVine(head, count);
+        numNodes = count;
+        throw;
+    }
+    root = fromVine(head, count);
+    numNodes = count;
+}
+
+// Merge function.
+// Description: This function moves every value of another BST into this one, reusing its nodes, as std::merge.
+// Parameters: the other BST, left empty.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::merge(BST<T, Comparator, Balance, Allocator, Stats> &&tree){
+    combine(tree, MergeValues);
+}
+
+// Unite function.
+// Description: This function adds the values of another BST that this one does not have yet, as std::set_union:
+// a value present i times here and j times in the other BST ends up max(i, j) times.
+// Parameters: the other BST, left empty.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::unite(BST<T, Comparator, Balance, Allocator, Stats> &&tree){
+    combine(tree, UniteValues);
+}
+
+// Intersect function.
+// Description: This function keeps only the values also present in another BST, as std::set_intersection:
+// a value present i times here and j times in the other BST ends up min(i, j) times.
+// Parameters: the other BST, left empty.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::intersect(BST<T, Comparator, Balance, Allocator, Stats> &&tree){
+    combine(tree, IntersectValues);
+}
+
+// Subtract function.
+// Description: This function removes the values present in another BST, as std::set_difference: a value
+// present i times here and j times in the other BST ends up max(i - j, 0) times.
+// Parameters: the other BST, left empty.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::subtract(BST<T, Comparator, Balance, Allocator, Stats> &&tree){
+    combine(tree, SubtractValues);
+}
+
+// Split function.
+// Description: This function moves every value not less than key into a new BST, reusing the nodes, and
+// rebalances both trees, in linear time. Reusing the nodes means sharing the allocator, and with it the pool.
+// Parameters: the key.
+// Return value: a BST with the values not less than key, sharing this BST's allocator.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+BST<T, Comparator, Balance, Allocator, Stats> BST<T,Comparator,Balance,Allocator,Stats>::split(const T &key){
+    BST<T, Comparator, Balance, Allocator, Stats> upper(comparator, Allocator(allocator));
+    upper.parallelism = parallelism;
+    BSTNode<T> *head = toVine(root);
+    size_t lowerCount = 0;
+    BSTNode<T> *upperHead = head;
+    BSTNode<T> *lowerTail = NULL;
+    while (upperHead != NULL && !compare(key, upperHead->value)){
+        lowerTail = upperHead;
+        upperHead = upperHead->right;
+        lowerCount++;
+    }
+    if (lowerTail != NULL){
+        lowerTail->right = NULL;
+    }
+    upper.root = fromVine(upperHead, numNodes - lowerCount);
+    upper.numNodes = numNodes - lowerCount;
+    root = fromVine(head, lowerCount);
+    numNodes = lowerCount;
+    return upper;
+}
+
+// Join function.
+// Description: This function appends the values of another BST, all of which must be not less than every value of
+// this one, reusing the nodes and rebalancing, in linear time and without comparing values beyond the check.
+// Parameters: the other BST, left empty.
+// Return value: NONE.
+// throws std::invalid_argument if the other BST has a value less than the maximum of this one.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+void BST<T,Comparator,Balance,Allocator,Stats>::join(BST<T, Comparator, Balance, Allocator, Stats> &&tree){
+    if (&tree == this || tree.root == NULL){
+        return;
+    }
+    if (root != NULL && !compare(root->treeMax()->value, tree.root->treeMin()->value)){
+        throw invalid_argument("Can not join a tree holding smaller values");
+    }
+    if (!canAdoptNodes(tree)){
+        combine(tree, MergeValues);
+        return;
+    }
+    BSTNode<T> *head = toVine(root);
+    BSTNode<T> *tail = head;
+    while (tail != NULL && tail->right != NULL){
+        tail = tail->right;
+    }
+    BSTNode<T> *otherHead = toVine(tree.root);
+    if (tail == NULL){
+        head = otherHead;
+    }
+    else {
+        tail->right = otherHead;
+    }
+    size_t count = numNodes + tree.numNodes;
+    tree.root = NULL;
+    tree.numNodes = 0;
+    root = fromVine(head, count);
+    numNodes = count;
+}
+
+// Begin.
+// Description: This function returns an iterator to the minimum of the BST.
+// Parameters: NONE.
+// Return value: an iterator to the minimum, or end() if the tree is empty.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+typename BST<T,Comparator,Balance,Allocator,Stats>::iterator BST<T,Comparator,Balance,Allocator,Stats>::begin(void) const{
+    return iterator((root == NULL) ? NULL : root->treeMin(), this);
+}
+
+// End.
+// Description: This function returns the past-the-end iterator of the BST.
+// Parameters: NONE.
+// Return value: the past-the-end iterator.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+typename BST<T,Comparator,Balance,Allocator,Stats>::iterator BST<T,Comparator,Balance,Allocator,Stats>::end(void) const{
+    return iterator(NULL, this);
+}
+
+// Reverse begin.
+// Description: This function returns a reverse iterator to the maximum of the BST.
+// Parameters: NONE.
+// Return value: a reverse iterator to the maximum, or rend() if the tree is empty.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+typename BST<T,Comparator,Balance,Allocator,Stats>::reverse_iterator BST<T,Comparator,Balance,Allocator,Stats>::rbegin(void) const{
+    return reverse_iterator(end());
+}
+
+// Reverse end.
+// Description: This function returns the past-the-end reverse iterator of the BST.
+// Parameters: NONE.
+// Return value: the past-the-end reverse iterator.
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+typename BST<T,Comparator,Balance,Allocator,Stats>::reverse_iterator BST<T,Comparator,Balance,Allocator,Stats>::rend(void) const{
+    return reverse_iterator(begin());
+}
@@ -0,0 +1,162 @@
+/*
+File name: BSTBalance.hpp
+Creation Date: 10/16/2026
+Description: Balancing policies for the BST<> templated class
+*/
+
+#pragma once
+
+#include "BSTNode.hpp"
+#include <cstdint>
+
+/*
+A balancing policy is passed to BST<> as its third template parameter. The tree calls the policy after every
+structural change, handing it the tree's root pointer so that the policy can restructure the tree with
+Node::rotateLeft and Node::rotateRight. Rotations only relink existing nodes, so the BSTNode<T>* handles
+returned by BST<>::insert stay valid.
+
+A policy must provide three static constexpr bools, which choose the fields of the tree's nodes (see
+BSTAugmentedNode in BSTNode.hpp):
+    tracksHeight: the nodes keep the height of their subtree
+    tracksSize: the nodes keep the size of their subtree, which the tree keeps up to date on the path to the root
+                in insert and erase
+    tracksAccesses: the nodes keep a count of the lookups that reached them, for the policy to maintain
+and the following static member function templates, whose first template argument is the tree's node type,
+BSTAugmentedNode<T, tracksHeight, tracksSize, tracksAccesses>:
+    afterInsert<Node>(root, node): called once `node` has been linked into the tree as a leaf
+    afterErase<Node>(root, node): called once a node has been unlinked; `node` is the lowest node whose subtree
+                            changed, or nullptr if the tree became empty
+    afterAccess<Node>(root, node): called by search, lower_bound, upper_bound and the other lookups with the last
+                            node the search visited, and by treeMin and treeMax with the node they return
+A policy that wraps another one passes its own Node on, so that the rotations of the wrapped policy keep every
+field of the node up to date, and only those.
+*/
+
+
+// Default policy: the tree keeps whatever shape the insertion order gives it.
+struct NoBalance {
+    static constexpr bool tracksHeight = false;
+    static constexpr bool tracksSize = false;
+    static constexpr bool tracksAccesses = false;
+
+    template<class Node, class T>
+    static void afterInsert(BSTNode<T>* &root, BSTNode<T> *node);
+
+    template<class Node, class T>
+    static void afterErase(BSTNode<T>* &root, BSTNode<T> *node);
+
+    template<class Node, class T>
+    static void afterAccess(BSTNode<T>* &root, BSTNode<T> *node);
+};
+
+
+// AVL policy: the heights of the two subtrees of every node differ by at most one,
+// so the height of the tree stays within 1.44 log2(n).
+struct AVLBalance {
+    static constexpr bool tracksHeight = true;
+    static constexpr bool tracksSize = false;
+    static constexpr bool tracksAccesses = false;
+
+    template<class Node, class T>
+    static void afterInsert(BSTNode<T>* &root, BSTNode<T> *node);
+
+    template<class Node, class T>
+    static void afterErase(BSTNode<T>* &root, BSTNode<T> *node);
+
+    template<class Node, class T>
+    static void afterAccess(BSTNode<T>* &root, BSTNode<T> *node);
+
+    private:
+    // walks from node to the root, restoring the AVL property on the way;
+    // stops as soon as a subtree's height is unchanged, since nothing above it can be affected
+    template<class Node, class T>
+    static void rebalance(BSTNode<T>* &root, BSTNode<T> *node);
+};
+
+
+// Order-statistic augmentation: wraps another policy and makes the tree maintain subtree sizes, which enables
+// BST<>::select, BST<>::rank and BST<>::count_range in O(height). Keeping the sizes costs a walk to the root on
+// every insert and erase, e.g. BST<int, std::less_equal<int>, OrderStatistics<AVLBalance> >.
+template<typename Base = NoBalance>
+struct OrderStatistics {
+    static constexpr bool tracksHeight = Base::tracksHeight;
+    static constexpr bool tracksSize = true;
+    static constexpr bool tracksAccesses = Base::tracksAccesses;
+
+    template<class Node, class T>
+    static void afterInsert(BSTNode<T>* &root, BSTNode<T> *node);
+
+    template<class Node, class T>
+    static void afterErase(BSTNode<T>* &root, BSTNode<T> *node);
+
+    template<class Node, class T>
+    static void afterAccess(BSTNode<T>* &root, BSTNode<T> *node);
+};
+
+
+// Splay policy: every insert, erase and lookup moves the node it reached to the root with zig-zig and zig-zag
+// rotations, which also roughly halves the depth of every node on the way. There is no bound on the height, but
+// any sequence of operations costs O(log n) amortized each, and a key that is looked up often stays within a few
+// levels of the root, so skewed workloads pay for their hot keys' recency rather than for the height of the
+// tree. Lookups restructure the tree, so even searches must not run concurrently.
+struct SplayBalance {
+    static constexpr bool tracksHeight = false;
+    static constexpr bool tracksSize = false;
+    static constexpr bool tracksAccesses = false;
+
+    template<class Node, class T>
+    static void afterInsert(BSTNode<T>* &root, BSTNode<T> *node);
+
+    template<class Node, class T>
+    static void afterErase(BSTNode<T>* &root, BSTNode<T> *node);
+
+    template<class Node, class T>
+    static void afterAccess(BSTNode<T>* &root, BSTNode<T> *node);
+
+    private:
+    // rotates node up until it is the root
+    template<class Node, class T>
+    static void splay(BSTNode<T>* &root, BSTNode<T> *node);
+};
+
+
+// Frequency-weighted splay policy: like SplayBalance, but a lookup only moves a node above the nodes that have been
+// looked up less often than it, so the tree settles with the most frequently used keys at the top instead of the
+// most recent one. Once the hot keys have gone past the cold ones, lookups of them cost a walk and a counter
+// increment, without the rotations a splay does at every access, and a key looked up once does not move at all.
+// Inserts leave the new leaf in place. Any insert or lookup that ends more than deepPath levels down splays its
+// node to the root, which halves the depth of the path, so sorted inserts and scans stay cheap. Erasing leaves the
+// rest of the tree as it is; it makes no node deeper. Each node counts the lookups that end on it (see afterAccess
+// above), and copies of the tree start counting afresh. Lookups restructure the tree, so even searches must not
+// run concurrently.
+struct FrequencySplayBalance {
+    static constexpr bool tracksHeight = false;
+    static constexpr bool tracksSize = false;
+    static constexpr bool tracksAccesses = true;
+
+    template<class Node, class T>
+    static void afterInsert(BSTNode<T>* &root, BSTNode<T> *node);
+
+    template<class Node, class T>
+    static void afterErase(BSTNode<T>* &root, BSTNode<T> *node);
+
+    template<class Node, class T>
+    static void afterAccess(BSTNode<T>* &root, BSTNode<T> *node);
+
+    private:
+    // depth beyond which inserts and lookups splay their node to the root whatever the counts, so that no path
+    // stays long; a balanced tree of a billion values is about 30 levels deep
+    static const size_t deepPath = 48;
+
+    // true if node is more than deepPath levels below the root
+    template<class T>
+    static bool isDeep(BSTNode<T> *node);
+
+    // rotates node above its parent
+    template<class Node, class T>
+    static void rotateUp(BSTNode<T>* &root, BSTNode<T> *node);
+
+    // splays node up past the ancestors that have been looked up fewer than weight times
+    template<class Node, class T>
+    static void splay(BSTNode<T>* &root, BSTNode<T> *node, size_t weight);
+};
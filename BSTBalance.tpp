@@ -0,0 +1,300 @@
+/*
+BSTBalance.tpp
+A file that contains the implementation of the balancing policies in the BSTBalance.hpp file.
+*/
+
+#include "BSTBalance.hpp"
+
+using namespace std;
+
+// No balance, after insert.
+// Description: Does nothing, the tree is left unbalanced.
+// Parameters: the root of the tree, the node that was inserted.
+// Return value: NONE.
+template<class Node, class T>
+void NoBalance::afterInsert(BSTNode<T>* &root, BSTNode<T> *node){
+    (void) root;
+    (void) node;
+}
+
+// No balance, after erase.
+// Description: Does nothing, the tree is left unbalanced.
+// Parameters: the root of the tree, the lowest node whose subtree changed.
+// Return value: NONE.
+template<class Node, class T>
+void NoBalance::afterErase(BSTNode<T>* &root, BSTNode<T> *node){
+    (void) root;
+    (void) node;
+}
+
+// No balance, after access.
+// Description: Does nothing, lookups leave the tree as it is.
+// Parameters: the root of the tree, the node a lookup reached.
+// Return value: NONE.
+template<class Node, class T>
+void NoBalance::afterAccess(BSTNode<T>* &root, BSTNode<T> *node){
+    (void) root;
+    (void) node;
+}
+
+// AVL, after insert.
+// Description: Restores the AVL property on the path from the new leaf to the root.
+// Parameters: the root of the tree, the node that was inserted.
+// Return value: NONE.
+template<class Node, class T>
+void AVLBalance::afterInsert(BSTNode<T>* &root, BSTNode<T> *node){
+    Node::update(node);
+    rebalance<Node>(root, node->getParent());
+}
+
+// AVL, after erase.
+// Description: Restores the AVL property on the path from the lowest changed node to the root.
+// Parameters: the root of the tree, the lowest node whose subtree changed.
+// Return value: NONE.
+template<class Node, class T>
+void AVLBalance::afterErase(BSTNode<T>* &root, BSTNode<T> *node){
+    rebalance<Node>(root, node);
+}
+
+// AVL, after access.
+// Description: Does nothing, lookups leave the tree as it is.
+// Parameters: the root of the tree, the node a lookup reached.
+// Return value: NONE.
+template<class Node, class T>
+void AVLBalance::afterAccess(BSTNode<T>* &root, BSTNode<T> *node){
+    (void) root;
+    (void) node;
+}
+
+// AVL rebalance.
+// Description: Updates heights from node upwards and performs single or double rotations
+// wherever the two subtrees of a node differ in height by two.
+// Parameters: the root of the tree, the first node to fix.
+// Return value: NONE.
+template<class Node, class T>
+void AVLBalance::rebalance(BSTNode<T>* &root, BSTNode<T> *node){
+    while (node != NULL){
+        int oldHeight = Node::heightOf(node);
+        int leftHeight = Node::heightOf(node->getLeftChild());
+        int rightHeight = Node::heightOf(node->getRightChild());
+
+        if (leftHeight - rightHeight > 1){
+            BSTNode<T> *child = node->getLeftChild();
+            if (Node::heightOf(child->getLeftChild()) < Node::heightOf(child->getRightChild())){
+                Node::rotateLeft(root, child);
+            }
+            node = Node::rotateRight(root, node);
+        }
+        else if (rightHeight - leftHeight > 1){
+            BSTNode<T> *child = node->getRightChild();
+            if (Node::heightOf(child->getRightChild()) < Node::heightOf(child->getLeftChild())){
+                Node::rotateRight(root, child);
+            }
+            node = Node::rotateLeft(root, node);
+        }
+        else {
+            Node::update(node);
+        }
+
+        if (Node::heightOf(node) == oldHeight){
+            return;
+        }
+        node = node->getParent();
+    }
+}
+
+// Order statistics, after insert.
+// Description: Sizes are already updated by the tree; defers to the wrapped policy.
+// Parameters: the root of the tree, the node that was inserted.
+// Return value: NONE.
+template<typename Base>
+template<class Node, class T>
+void OrderStatistics<Base>::afterInsert(BSTNode<T>* &root, BSTNode<T> *node){
+    Base::template afterInsert<Node>(root, node);
+}
+
+// Order statistics, after erase.
+// Description: Sizes are already updated by the tree; defers to the wrapped policy.
+// Parameters: the root of the tree, the lowest node whose subtree changed.
+// Return value: NONE.
+template<typename Base>
+template<class Node, class T>
+void OrderStatistics<Base>::afterErase(BSTNode<T>* &root, BSTNode<T> *node){
+    Base::template afterErase<Node>(root, node);
+}
+
+// Order statistics, after access.
+// Description: Defers to the wrapped policy; rotations keep the sizes up to date.
+// Parameters: the root of the tree, the node a lookup reached.
+// Return value: NONE.
+template<typename Base>
+template<class Node, class T>
+void OrderStatistics<Base>::afterAccess(BSTNode<T>* &root, BSTNode<T> *node){
+    Base::template afterAccess<Node>(root, node);
+}
+
+// Splay, after insert.
+// Description: Splays the new leaf to the root.
+// Parameters: the root of the tree, the node that was inserted.
+// Return value: NONE.
+template<class Node, class T>
+void SplayBalance::afterInsert(BSTNode<T>* &root, BSTNode<T> *node){
+    splay<Node>(root, node);
+}
+
+// Splay, after erase.
+// Description: Splays the lowest node whose subtree changed, which is next to the erased value, to the root.
+// Parameters: the root of the tree, the lowest node whose subtree changed.
+// Return value: NONE.
+template<class Node, class T>
+void SplayBalance::afterErase(BSTNode<T>* &root, BSTNode<T> *node){
+    if (node != NULL){
+        splay<Node>(root, node);
+    }
+}
+
+// Splay, after access.
+// Description: Splays the node a lookup reached to the root. A search splays the last node on its path, which is
+// the value found or the one next to it, so repeating the search costs a couple of levels.
+// Parameters: the root of the tree, the node a lookup reached.
+// Return value: NONE.
+template<class Node, class T>
+void SplayBalance::afterAccess(BSTNode<T>* &root, BSTNode<T> *node){
+    splay<Node>(root, node);
+}
+
+// Splay.
+// Description: Moves node to the root two levels at a time. When node and its parent are children on the same
+// side (zig-zig), the grandparent is rotated first, then the parent; otherwise (zig-zag) the parent is rotated,
+// then the grandparent. A single rotation (zig) finishes when the parent is the root.
+// Parameters: the root of the tree, the node to move up.
+// Return value: NONE.
+template<class Node, class T>
+void SplayBalance::splay(BSTNode<T>* &root, BSTNode<T> *node){
+    while (node->getParent() != NULL){
+        BSTNode<T> *parent = node->getParent();
+        BSTNode<T> *grandparent = parent->getParent();
+        bool nodeLeft = (parent->getLeftChild() == node);
+        if (grandparent == NULL){
+            if (nodeLeft){
+                Node::rotateRight(root, parent);
+            }
+            else{
+                Node::rotateLeft(root, parent);
+            }
+            return;
+        }
+        bool parentLeft = (grandparent->getLeftChild() == parent);
+        if (nodeLeft == parentLeft){
+            if (nodeLeft){
+                Node::rotateRight(root, grandparent);
+                Node::rotateRight(root, parent);
+            }
+            else{
+                Node::rotateLeft(root, grandparent);
+                Node::rotateLeft(root, parent);
+            }
+        }
+        else{
+            if (nodeLeft){
+                Node::rotateRight(root, parent);
+                Node::rotateLeft(root, grandparent);
+            }
+            else{
+                Node::rotateLeft(root, parent);
+                Node::rotateRight(root, grandparent);
+            }
+        }
+    }
+}
+
+// Frequency splay, after insert.
+// Description: Leaves the new leaf where it is, unless it is deeper than deepPath, in which case it is splayed all
+// the way to the root.
+// Parameters: the root of the tree, the node that was inserted.
+// Return value: NONE.
+template<class Node, class T>
+void FrequencySplayBalance::afterInsert(BSTNode<T>* &root, BSTNode<T> *node){
+    if (isDeep(node)){
+        splay<Node>(root, node, SIZE_MAX);
+    }
+}
+
+// Frequency splay, after erase.
+// Description: Does nothing; removing a node makes no other node deeper.
+// Parameters: the root of the tree, the lowest node whose subtree changed.
+// Return value: NONE.
+template<class Node, class T>
+void FrequencySplayBalance::afterErase(BSTNode<T>* &root, BSTNode<T> *node){
+    (void) root;
+    (void) node;
+}
+
+// Frequency splay, after access.
+// Description: Counts the lookup, then splays the node up past the ancestors that have been looked up less often
+// than it had been before, so that a node looked up once stays where it is. A node deeper than deepPath is splayed
+// all the way to the root.
+// Parameters: the root of the tree, the node a lookup reached.
+// Return value: NONE.
+template<class Node, class T>
+void FrequencySplayBalance::afterAccess(BSTNode<T>* &root, BSTNode<T> *node){
+    size_t previous = Node::recordAccess(node) - 1;
+    splay<Node>(root, node, isDeep(node) ? SIZE_MAX : previous);
+}
+
+// Frequency splay, is deep.
+// Description: Counts the ancestors of node, up to deepPath + 1 of them.
+// Parameters: a node of the tree.
+// Return value: true if node is more than deepPath levels below the root.
+template<class T>
+bool FrequencySplayBalance::isDeep(BSTNode<T> *node){
+    size_t depth = 0;
+    for (BSTNode<T> *ancestor = node->getParent(); ancestor != NULL; ancestor = ancestor->getParent()){
+        if (++depth > deepPath){
+            return true;
+        }
+    }
+    return false;
+}
+
+// Frequency splay, rotate up.
+// Description: Rotates the parent of node right if node is its left child, left otherwise.
+// Parameters: the root of the tree, a node that has a parent.
+// Return value: NONE.
+template<class Node, class T>
+void FrequencySplayBalance::rotateUp(BSTNode<T>* &root, BSTNode<T> *node){
+    if (node->getParent()->getLeftChild() == node){
+        Node::rotateRight(root, node->getParent());
+    }
+    else{
+        Node::rotateLeft(root, node->getParent());
+    }
+}
+
+// Frequency splay.
+// Description: Moves node up two levels at a time with zig-zig and zig-zag steps while its parent and grandparent
+// have both been looked up fewer than weight times, then by one level (zig) if only its parent has. A node that
+// is looked up often therefore stops below the nodes that are looked up more often still.
+// Parameters: the root of the tree, the node to move up, its weight.
+// Return value: NONE.
+template<class Node, class T>
+void FrequencySplayBalance::splay(BSTNode<T>* &root, BSTNode<T> *node, size_t weight){
+    while (node->getParent() != NULL){
+        BSTNode<T> *parent = node->getParent();
+        BSTNode<T> *grandparent = parent->getParent();
+        if (static_cast<Node *>(parent)->getAccesses() >= weight){
+            return;
+        }
+        if (grandparent == NULL || static_cast<Node *>(grandparent)->getAccesses() >= weight){
+            rotateUp<Node>(root, node);
+            return;
+        }
+        if ((grandparent->getLeftChild() == parent) == (parent->getLeftChild() == node)){
+            rotateUp<Node>(root, parent);
+        }
+        else{
+            rotateUp<Node>(root, node);
+        }
+        rotateUp<Node>(root, node);
+    }
+}
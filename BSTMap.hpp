@@ -0,0 +1,239 @@
+/*
+File name: BSTMap.hpp
+Creation Date: 10/16/2026
+Description: Header file for the BSTMap<> templated class, a key/value map on top of BST<>; requires C++20
+*/
+
+#pragma once
+
+#include "BST.hpp"
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/*
+BSTMap maps unique keys to values. Entries are std::pair<const K, V> stored in the nodes of a BST<>, so the
+balancing policies, allocators, iterators, copying and set algebra of BST<> all apply, but every key search is done
+by the map itself with one three-way comparison per level: a descent stops as soon as it finds the key, and no
+extra equality check is needed.
+
+Compare is a three-way comparator: compare(a, b) returns a std::strong_ordering, std::weak_ordering or
+std::partial_ordering for keys a and b. The default, std::compare_three_way, uses operator<=>. Keys are always
+taken by reference. If Compare defines is_transparent (std::compare_three_way does), lookups accept any type that
+compares with K, e.g. a std::string_view for std::string keys, without building a K.
+*/
+// Key can be looked up directly in a map with keys of type K: Compare is transparent and compares Key with K.
+template<class Key, class K, class Compare>
+concept HeterogeneousKey = requires(const Compare &compare, const Key &key, const K &mapKey) {
+    typename Compare::is_transparent;
+    compare(key, mapKey);
+};
+
+
+template<class K, class V, class Compare = std::compare_three_way, typename Balance = NoBalance,
+         typename Allocator = PoolAllocator<std::pair<const K, V> > >
+class BSTMap {
+
+    public:
+    typedef K key_type;
+    typedef V mapped_type;
+    typedef std::pair<const K, V> value_type;
+
+
+    private:
+    // Orders entries for the BST operations that compare whole values, such as set algebra; the map's own
+    // searches never go through it.
+    struct EntryComparator {
+        Compare compare;
+
+        bool operator()(const value_type &a, const value_type &b) const { return compare(a.first, b.first) <= 0; }
+    };
+
+    typedef BST<value_type, EntryComparator, Balance, Allocator> Tree;
+    typedef BSTNode<value_type> Node;
+
+    Tree tree;
+    Compare compare;
+
+    // node holding key, NULL if there is none
+    template<class Key>
+    Node* findNode(const Key &key) const;
+    // first node whose key is not less than key (greater than key if strict), NULL if there is none
+    template<class Key>
+    Node* lowerBoundNode(const Key &key, bool strict) const;
+    // node holding key, after creating it from key and args if there was none
+    template<class KeyArg, class... Args>
+    std::pair<Node*, bool> tryEmplaceNode(KeyArg &&key, Args&&... args);
+
+
+    public:
+    // Bidirectional iterator over the entries in key order; Value is value_type for iterator and
+    // const value_type for const_iterator. Keys are const, mapped values can be changed through iterator.
+    template<class Value>
+    class BasicIterator {
+        private:
+        Node *node;
+        const BSTMap<K, V, Compare, Balance, Allocator> *map;
+
+        friend class BSTMap<K, V, Compare, Balance, Allocator>;
+        template<class OtherValue>
+        friend class BasicIterator;
+
+        public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef std::pair<const K, V> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Value* pointer;
+        typedef Value& reference;
+
+        BasicIterator(void) : node(nullptr), map(nullptr) {}
+        BasicIterator(Node *node, const BSTMap<K, V, Compare, Balance, Allocator> *map) : node(node), map(map) {}
+        // an iterator converts to a const_iterator
+        BasicIterator(const BasicIterator<std::remove_const_t<Value> > &other) : node(other.node), map(other.map) {}
+
+        reference operator*(void) const { return node->getValue(); }
+        pointer operator->(void) const { return &node->getValue(); }
+
+        BasicIterator& operator++(void) { node = node->successor(); return *this; }
+        BasicIterator operator++(int) { BasicIterator old = *this; ++(*this); return old; }
+        // decrementing end() yields the last entry
+        BasicIterator& operator--(void) { node = (node == nullptr) ? map->tree.root->treeMax() : node->predecessor(); return *this; }
+        BasicIterator operator--(int) { BasicIterator old = *this; --(*this); return old; }
+
+        bool operator==(const BasicIterator &rhs) const { return node == rhs.node; }
+    };
+    typedef BasicIterator<value_type> iterator;
+    typedef BasicIterator<const value_type> const_iterator;
+
+
+    // default constructor
+    BSTMap(Compare compare = Compare(), const Allocator &allocator = Allocator());
+
+
+    // checks if is empty
+    bool empty(void) const;
+
+
+    // size
+    size_t size(void) const;
+
+
+    // clear; removes every entry
+    void clear(void);
+
+
+    // try_emplace
+    // if key is absent, inserts an entry with the value constructed from args; otherwise does nothing, and args are
+    // not moved from. Returns the entry with key and whether it was inserted.
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const K &key, Args&&... args);
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(K &&key, Args&&... args);
+
+
+    // insert_or_assign
+    // inserts an entry with value if key is absent, or assigns value to the existing entry. Returns the entry with
+    // key and whether it was inserted.
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const K &key, M &&value);
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(K &&key, M &&value);
+
+
+    // insert; inserts a copy of entry if its key is absent
+    std::pair<iterator, bool> insert(const value_type &entry);
+
+
+    // subscript; the value of key, inserting a value-initialized one if key is absent
+    V& operator[](const K &key);
+    V& operator[](K &&key);
+
+
+    // lookups; take a K, or anything that compares with K if Compare is transparent
+
+    // at; the value of key
+    // throws std::out_of_range if key is absent
+    V& at(const K &key);
+    const V& at(const K &key) const;
+
+    template<class Key>
+        requires HeterogeneousKey<Key, K, Compare>
+    V& at(const Key &key);
+
+    template<class Key>
+        requires HeterogeneousKey<Key, K, Compare>
+    const V& at(const Key &key) const;
+
+    // find; the entry with key, end() if there is none
+    iterator find(const K &key);
+    const_iterator find(const K &key) const;
+
+    template<class Key>
+        requires HeterogeneousKey<Key, K, Compare>
+    iterator find(const Key &key);
+
+    template<class Key>
+        requires HeterogeneousKey<Key, K, Compare>
+    const_iterator find(const Key &key) const;
+
+
+    // contains
+    bool contains(const K &key) const;
+
+    template<class Key>
+        requires HeterogeneousKey<Key, K, Compare>
+    bool contains(const Key &key) const;
+
+
+    // lower_bound; the first entry whose key is not less than key, end() if there is none
+    iterator lower_bound(const K &key);
+    const_iterator lower_bound(const K &key) const;
+
+    template<class Key>
+        requires HeterogeneousKey<Key, K, Compare>
+    iterator lower_bound(const Key &key);
+
+    template<class Key>
+        requires HeterogeneousKey<Key, K, Compare>
+    const_iterator lower_bound(const Key &key) const;
+
+
+    // upper_bound; the first entry whose key is greater than key, end() if there is none
+    iterator upper_bound(const K &key);
+    const_iterator upper_bound(const K &key) const;
+
+    template<class Key>
+        requires HeterogeneousKey<Key, K, Compare>
+    iterator upper_bound(const Key &key);
+
+    template<class Key>
+        requires HeterogeneousKey<Key, K, Compare>
+    const_iterator upper_bound(const Key &key) const;
+
+
+    // erase; removes the entry with key, if any, and returns the number of entries removed
+    size_t erase(const K &key);
+
+    template<class Key>
+        requires HeterogeneousKey<Key, K, Compare>
+    size_t erase(const Key &key);
+
+
+    // erase; removes the entry at position and returns the entry after it
+    // throws std::invalid_argument if position is end()
+    iterator erase(const_iterator position);
+
+
+    // iterators, in key order
+    iterator begin(void);
+    iterator end(void);
+    const_iterator begin(void) const;
+    const_iterator end(void) const;
+};
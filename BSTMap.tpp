@@ -0,0 +1,487 @@
+/*
+BSTMap.tpp
+A file that contains the implementation of the BSTMap class methods in the BSTMap.hpp file.
+*/
+
+#pragma once
+
+#include "BSTMap.hpp"
+
+using namespace std;
+
+// Default constructor.
+// Description: This function constructs an empty map.
+// Parameters: the three-way comparator, the allocator.
+// Return value: NONE.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+BSTMap<K,V,Compare,Balance,Allocator>::BSTMap(Compare compare, const Allocator &allocator)
+    : tree(EntryComparator{compare}, allocator), compare(compare){
+}
+
+// Checks if is empty.
+// Description: This function checks if the map is empty.
+// Parameters: NONE.
+// Return value: true if the map is empty, and false otherwise.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+bool BSTMap<K,V,Compare,Balance,Allocator>::empty(void) const{
+    return tree.empty();
+}
+
+// Size.
+// Description: This function returns the number of entries in the map.
+// Parameters: NONE.
+// Return value: the number of entries.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+size_t BSTMap<K,V,Compare,Balance,Allocator>::size(void) const{
+    return tree.size();
+}
+
+// Clear function.
+// Description: This function removes every entry.
+// Parameters: NONE.
+// Return value: NONE.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+void BSTMap<K,V,Compare,Balance,Allocator>::clear(void){
+    tree.deleteSubTree(tree.root);
+    tree.root = NULL;
+    tree.numNodes = 0;
+}
+
+// Find node function.
+// Description: This function descends from the root with one three-way comparison per level, stopping at the key.
+// Parameters: the key.
+// Return value: the node holding key, or NULL if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class Key>
+typename BSTMap<K,V,Compare,Balance,Allocator>::Node* BSTMap<K,V,Compare,Balance,Allocator>::findNode(const Key &key) const{
+    Node *current = tree.root;
+    while (current != NULL){
+        auto order = compare(key, current->getValue().first);
+        if (order < 0){
+            current = current->getLeftChild();
+        }
+        else if (order > 0){
+            current = current->getRightChild();
+        }
+        else {
+            return current;
+        }
+    }
+    return NULL;
+}
+
+// Lower bound node function.
+// Description: This function descends from the root, remembering the last node where it turned left; an equal
+// key ends the descent right away unless strict.
+// Parameters: the key; whether to skip an entry with an equal key.
+// Return value: the first node whose key is not less than key (greater than key if strict), or NULL if there is
+// none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class Key>
+typename BSTMap<K,V,Compare,Balance,Allocator>::Node* BSTMap<K,V,Compare,Balance,Allocator>::lowerBoundNode(const Key &key, bool strict) const{
+    Node *candidate = NULL;
+    Node *current = tree.root;
+    while (current != NULL){
+        auto order = compare(key, current->getValue().first);
+        if (order < 0){
+            candidate = current;
+            current = current->getLeftChild();
+        }
+        else if (order > 0){
+            current = current->getRightChild();
+        }
+        else {
+            return strict ? current->successor() : current;
+        }
+    }
+    return candidate;
+}
+
+// Try emplace node function.
+// Description: This function descends to key with one three-way comparison per level. If key is absent, the entry
+// is constructed in a new node from key and args, linked where the descent ended, and the policy rebalances.
+// Parameters: the key, forwarded to the new entry; the arguments of the value.
+// Return value: the node holding key, and whether it was created.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class KeyArg, class... Args>
+pair<typename BSTMap<K,V,Compare,Balance,Allocator>::Node*, bool> BSTMap<K,V,Compare,Balance,Allocator>::tryEmplaceNode(KeyArg &&key, Args&&... args){
+    Node *parent = NULL;
+    Node *current = tree.root;
+    bool goLeft = false;
+    while (current != NULL){
+        auto order = compare(key, current->getValue().first);
+        if (order == 0){
+            return pair<Node*, bool>(current, false);
+        }
+        parent = current;
+        goLeft = (order < 0);
+        current = goLeft ? current->getLeftChild() : current->getRightChild();
+    }
+    Node *node = tree.emplaceNode(piecewise_construct, forward_as_tuple(std::forward<KeyArg>(key)),
+                                  forward_as_tuple(std::forward<Args>(args)...));
+    tree.linkNode(parent, node, goLeft);
+    return pair<Node*, bool>(node, true);
+}
+
+// Try emplace function.
+// Description: This function inserts an entry for key with the value constructed from args, if key is absent.
+// Parameters: the key, the arguments of the value.
+// Return value: the entry with key, and whether it was inserted.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class... Args>
+pair<typename BSTMap<K,V,Compare,Balance,Allocator>::iterator, bool> BSTMap<K,V,Compare,Balance,Allocator>::try_emplace(const K &key, Args&&... args){
+    pair<Node*, bool> result = tryEmplaceNode(key, std::forward<Args>(args)...);
+    return pair<iterator, bool>(iterator(result.first, this), result.second);
+}
+
+// Try emplace function.
+// Description: This function inserts an entry for key with the value constructed from args, if key is absent; key
+// is moved into the entry only if it is inserted.
+// Parameters: the key, the arguments of the value.
+// Return value: the entry with key, and whether it was inserted.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class... Args>
+pair<typename BSTMap<K,V,Compare,Balance,Allocator>::iterator, bool> BSTMap<K,V,Compare,Balance,Allocator>::try_emplace(K &&key, Args&&... args){
+    pair<Node*, bool> result = tryEmplaceNode(std::move(key), std::forward<Args>(args)...);
+    return pair<iterator, bool>(iterator(result.first, this), result.second);
+}
+
+// Insert or assign function.
+// Description: This function inserts an entry for key with value, or assigns value to the existing entry.
+// Parameters: the key, the value.
+// Return value: the entry with key, and whether it was inserted.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class M>
+pair<typename BSTMap<K,V,Compare,Balance,Allocator>::iterator, bool> BSTMap<K,V,Compare,Balance,Allocator>::insert_or_assign(const K &key, M &&value){
+    pair<Node*, bool> result = tryEmplaceNode(key, std::forward<M>(value));
+    if (!result.second){
+        // value was not used by tryEmplaceNode, so it can still be forwarded
+        result.first->getValue().second = std::forward<M>(value);
+    }
+    return pair<iterator, bool>(iterator(result.first, this), result.second);
+}
+
+// Insert or assign function.
+// Description: This function inserts an entry for key with value, or assigns value to the existing entry; key is
+// moved into the entry only if it is inserted.
+// Parameters: the key, the value.
+// Return value: the entry with key, and whether it was inserted.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class M>
+pair<typename BSTMap<K,V,Compare,Balance,Allocator>::iterator, bool> BSTMap<K,V,Compare,Balance,Allocator>::insert_or_assign(K &&key, M &&value){
+    pair<Node*, bool> result = tryEmplaceNode(std::move(key), std::forward<M>(value));
+    if (!result.second){
+        result.first->getValue().second = std::forward<M>(value);
+    }
+    return pair<iterator, bool>(iterator(result.first, this), result.second);
+}
+
+// Insert function.
+// Description: This function inserts a copy of an entry if its key is absent.
+// Parameters: the entry.
+// Return value: the entry with the same key, and whether it was inserted.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+pair<typename BSTMap<K,V,Compare,Balance,Allocator>::iterator, bool> BSTMap<K,V,Compare,Balance,Allocator>::insert(const value_type &entry){
+    return try_emplace(entry.first, entry.second);
+}
+
+// Subscript operator.
+// Description: This function returns the value of key, inserting a value-initialized one if key is absent.
+// Parameters: the key.
+// Return value: a reference to the value.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+V& BSTMap<K,V,Compare,Balance,Allocator>::operator[](const K &key){
+    return tryEmplaceNode(key).first->getValue().second;
+}
+
+// Subscript operator.
+// Description: This function returns the value of key, inserting a value-initialized one if key is absent; key is
+// moved into the entry only if it is inserted.
+// Parameters: the key.
+// Return value: a reference to the value.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+V& BSTMap<K,V,Compare,Balance,Allocator>::operator[](K &&key){
+    return tryEmplaceNode(std::move(key)).first->getValue().second;
+}
+
+// At function.
+// Description: This function returns the value of key.
+// Parameters: the key.
+// Return value: a reference to the value.
+// throws std::out_of_range if key is absent.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+V& BSTMap<K,V,Compare,Balance,Allocator>::at(const K &key){
+    Node *node = findNode(key);
+    if (node == NULL){
+        throw out_of_range("Key not found");
+    }
+    return node->getValue().second;
+}
+
+// At function.
+// Description: This function returns the value of key.
+// Parameters: the key.
+// Return value: a const reference to the value.
+// throws std::out_of_range if key is absent.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+const V& BSTMap<K,V,Compare,Balance,Allocator>::at(const K &key) const{
+    Node *node = findNode(key);
+    if (node == NULL){
+        throw out_of_range("Key not found");
+    }
+    return node->getValue().second;
+}
+
+// At function.
+// Description: This function returns the value of a key that compares with K.
+// Parameters: the key.
+// Return value: a reference to the value.
+// throws std::out_of_range if key is absent.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class Key>
+    requires HeterogeneousKey<Key, K, Compare>
+V& BSTMap<K,V,Compare,Balance,Allocator>::at(const Key &key){
+    Node *node = findNode(key);
+    if (node == NULL){
+        throw out_of_range("Key not found");
+    }
+    return node->getValue().second;
+}
+
+// At function.
+// Description: This function returns the value of a key that compares with K.
+// Parameters: the key.
+// Return value: a const reference to the value.
+// throws std::out_of_range if key is absent.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class Key>
+    requires HeterogeneousKey<Key, K, Compare>
+const V& BSTMap<K,V,Compare,Balance,Allocator>::at(const Key &key) const{
+    Node *node = findNode(key);
+    if (node == NULL){
+        throw out_of_range("Key not found");
+    }
+    return node->getValue().second;
+}
+
+// Find function.
+// Description: This function looks for the entry with key.
+// Parameters: the key.
+// Return value: an iterator to the entry, or end() if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+typename BSTMap<K,V,Compare,Balance,Allocator>::iterator BSTMap<K,V,Compare,Balance,Allocator>::find(const K &key){
+    return iterator(findNode(key), this);
+}
+
+// Find function.
+// Description: This function looks for the entry with key.
+// Parameters: the key.
+// Return value: an iterator to the entry, or end() if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+typename BSTMap<K,V,Compare,Balance,Allocator>::const_iterator BSTMap<K,V,Compare,Balance,Allocator>::find(const K &key) const{
+    return const_iterator(findNode(key), this);
+}
+
+// Find function.
+// Description: This function looks for the entry with a key that compares with K.
+// Parameters: the key.
+// Return value: an iterator to the entry, or end() if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class Key>
+    requires HeterogeneousKey<Key, K, Compare>
+typename BSTMap<K,V,Compare,Balance,Allocator>::iterator BSTMap<K,V,Compare,Balance,Allocator>::find(const Key &key){
+    return iterator(findNode(key), this);
+}
+
+// Find function.
+// Description: This function looks for the entry with a key that compares with K.
+// Parameters: the key.
+// Return value: an iterator to the entry, or end() if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class Key>
+    requires HeterogeneousKey<Key, K, Compare>
+typename BSTMap<K,V,Compare,Balance,Allocator>::const_iterator BSTMap<K,V,Compare,Balance,Allocator>::find(const Key &key) const{
+    return const_iterator(findNode(key), this);
+}
+
+// Contains function.
+// Description: This function checks for an entry with key.
+// Parameters: the key.
+// Return value: true if there is one, and false otherwise.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+bool BSTMap<K,V,Compare,Balance,Allocator>::contains(const K &key) const{
+    return findNode(key) != NULL;
+}
+
+// Contains function.
+// Description: This function checks for an entry with a key that compares with K.
+// Parameters: the key.
+// Return value: true if there is one, and false otherwise.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class Key>
+    requires HeterogeneousKey<Key, K, Compare>
+bool BSTMap<K,V,Compare,Balance,Allocator>::contains(const Key &key) const{
+    return findNode(key) != NULL;
+}
+
+// Lower bound function.
+// Description: This function finds the first entry whose key is not less than key.
+// Parameters: the key.
+// Return value: an iterator to the entry, or end() if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+typename BSTMap<K,V,Compare,Balance,Allocator>::iterator BSTMap<K,V,Compare,Balance,Allocator>::lower_bound(const K &key){
+    return iterator(lowerBoundNode(key, false), this);
+}
+
+// Lower bound function.
+// Description: This function finds the first entry whose key is not less than key.
+// Parameters: the key.
+// Return value: an iterator to the entry, or end() if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+typename BSTMap<K,V,Compare,Balance,Allocator>::const_iterator BSTMap<K,V,Compare,Balance,Allocator>::lower_bound(const K &key) const{
+    return const_iterator(lowerBoundNode(key, false), this);
+}
+
+// Lower bound function.
+// Description: This function finds the first entry whose key is not less than a key that compares with K.
+// Parameters: the key.
+// Return value: an iterator to the entry, or end() if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class Key>
+    requires HeterogeneousKey<Key, K, Compare>
+typename BSTMap<K,V,Compare,Balance,Allocator>::iterator BSTMap<K,V,Compare,Balance,Allocator>::lower_bound(const Key &key){
+    return iterator(lowerBoundNode(key, false), this);
+}
+
+// Lower bound function.
+// Description: This function finds the first entry whose key is not less than a key that compares with K.
+// Parameters: the key.
+// Return value: an iterator to the entry, or end() if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class Key>
+    requires HeterogeneousKey<Key, K, Compare>
+typename BSTMap<K,V,Compare,Balance,Allocator>::const_iterator BSTMap<K,V,Compare,Balance,Allocator>::lower_bound(const Key &key) const{
+    return const_iterator(lowerBoundNode(key, false), this);
+}
+
+// Upper bound function.
+// Description: This function finds the first entry whose key is greater than key.
+// Parameters: the key.
+// Return value: an iterator to the entry, or end() if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+typename BSTMap<K,V,Compare,Balance,Allocator>::iterator BSTMap<K,V,Compare,Balance,Allocator>::upper_bound(const K &key){
+    return iterator(lowerBoundNode(key, true), this);
+}
+
+// Upper bound function.
+// Description: This function finds the first entry whose key is greater than key.
+// Parameters: the key.
+// Return value: an iterator to the entry, or end() if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+typename BSTMap<K,V,Compare,Balance,Allocator>::const_iterator BSTMap<K,V,Compare,Balance,Allocator>::upper_bound(const K &key) const{
+    return const_iterator(lowerBoundNode(key, true), this);
+}
+
+// Upper bound function.
+// Description: This function finds the first entry whose key is greater than a key that compares with K.
+// Parameters: the key.
+// Return value: an iterator to the entry, or end() if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class Key>
+    requires HeterogeneousKey<Key, K, Compare>
+typename BSTMap<K,V,Compare,Balance,Allocator>::iterator BSTMap<K,V,Compare,Balance,Allocator>::upper_bound(const Key &key){
+    return iterator(lowerBoundNode(key, true), this);
+}
+
+// Upper bound function.
+// Description: This function finds the first entry whose key is greater than a key that compares with K.
+// Parameters: the key.
+// Return value: an iterator to the entry, or end() if there is none.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class Key>
+    requires HeterogeneousKey<Key, K, Compare>
+typename BSTMap<K,V,Compare,Balance,Allocator>::const_iterator BSTMap<K,V,Compare,Balance,Allocator>::upper_bound(const Key &key) const{
+    return const_iterator(lowerBoundNode(key, true), this);
+}
+
+// Erase function.
+// Description: This function removes the entry with key, if any.
+// Parameters: the key.
+// Return value: the number of entries removed, 0 or 1.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+size_t BSTMap<K,V,Compare,Balance,Allocator>::erase(const K &key){
+    Node *node = findNode(key);
+    if (node == NULL){
+        return 0;
+    }
+    tree.erase(node);
+    return 1;
+}
+
+// Erase function.
+// Description: This function removes the entry with a key that compares with K, if any.
+// Parameters: the key.
+// Return value: the number of entries removed, 0 or 1.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+template<class Key>
+    requires HeterogeneousKey<Key, K, Compare>
+size_t BSTMap<K,V,Compare,Balance,Allocator>::erase(const Key &key){
+    Node *node = findNode(key);
+    if (node == NULL){
+        return 0;
+    }
+    tree.erase(node);
+    return 1;
+}
+
+// Erase function.
+// Description: This function removes the entry at an iterator. The other entries keep their nodes, so iterators
+// to them stay valid.
+// Parameters: an iterator to the entry.
+// Return value: an iterator to the entry after it.
+// throws std::invalid_argument if position is end().
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+typename BSTMap<K,V,Compare,Balance,Allocator>::iterator BSTMap<K,V,Compare,Balance,Allocator>::erase(const_iterator position){
+    if (position.node == NULL){
+        throw invalid_argument("Can not erase end()");
+    }
+    Node *next = position.node->successor();
+    tree.erase(position.node);
+    return iterator(next, this);
+}
+
+// Begin.
+// Description: This function returns an iterator to the entry with the smallest key.
+// Parameters: NONE.
+// Return value: an iterator to the first entry, or end() if the map is empty.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+typename BSTMap<K,V,Compare,Balance,Allocator>::iterator BSTMap<K,V,Compare,Balance,Allocator>::begin(void){
+    return iterator(tree.root == NULL ? NULL : tree.root->treeMin(), this);
+}
+
+// End.
+// Description: This function returns the past-the-end iterator.
+// Parameters: NONE.
+// Return value: an iterator that points at no entry.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+typename BSTMap<K,V,Compare,Balance,Allocator>::iterator BSTMap<K,V,Compare,Balance,Allocator>::end(void){
+    return iterator(NULL, this);
+}
+
+// Begin.
+// Description: This function returns an iterator to the entry with the smallest key.
+// Parameters: NONE.
+// Return value: an iterator to the first entry, or end() if the map is empty.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+typename BSTMap<K,V,Compare,Balance,Allocator>::const_iterator BSTMap<K,V,Compare,Balance,Allocator>::begin(void) const{
+    return const_iterator(tree.root == NULL ? NULL : tree.root->treeMin(), this);
+}
+
+// End.
+// Description: This function returns the past-the-end iterator.
+// Parameters: NONE.
+// Return value: an iterator that points at no entry.
+template<class K, class V, class Compare, typename Balance, typename Allocator>
+typename BSTMap<K,V,Compare,Balance,Allocator>::const_iterator BSTMap<K,V,Compare,Balance,Allocator>::end(void) const{
+    return const_iterator(NULL, this);
+}
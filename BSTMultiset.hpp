@@ -0,0 +1,166 @@
+/*
+File name: BSTMultiset.hpp
+Creation Date: 10/16/2026
+Description: Header file for the BSTMultiset<> templated class, a BST<> that stores equal values once with a count
+*/
+
+#pragma once
+
+#include "BST.hpp"
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+
+/*
+A BST<> keeps every duplicate in a node of its own: with the default std::less_equal comparator, equal values pile
+up as a chain down the left side of the first one, and a key repeated k times costs k nodes and makes every
+search that reaches it k levels longer. BSTMultiset stores each distinct value once, in a node holding the value
+and how many times it was inserted, so the tree only grows with the number of distinct values.
+
+Equal values are treated as interchangeable: the node keeps the first one inserted, and later equal values only
+increase its count. Iterators expand the counts as they go, visiting a value as many times as it was inserted,
+without copying anything. The comparator follows the BST<> convention: comparator(a, b) is true if a <= b.
+*/
+template<class T, typename Comparator = std::less_equal<T>, typename Balance = NoBalance, typename Allocator = PoolAllocator<T> >
+class BSTMultiset {
+
+    private:
+    struct Entry {
+        T value;
+        // number of times value was inserted, at least 1
+        size_t count;
+
+        Entry(const T &value, size_t count) : value(value), count(count) {}
+    };
+
+    struct EntryComparator {
+        Comparator comparator;
+
+        bool operator()(const Entry &a, const Entry &b) const { return comparator(a.value, b.value); }
+    };
+
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Entry> EntryAllocator;
+    typedef BST<Entry, EntryComparator, Balance, EntryAllocator> Tree;
+    typedef BSTNode<Entry> Node;
+
+    Tree tree;
+    // number of values, counting every copy; tree.size() is the number of distinct values
+    size_t numValues;
+    Comparator comparator;
+
+    // first node whose value is not less than value (greater than value if strict), NULL if there is none
+    Node* lowerBoundNode(const T &value, bool strict) const;
+    // node holding value, NULL if there is none
+    Node* findNode(const T &value) const;
+
+
+    public:
+    // Bidirectional iterator over the values in order, each repeated as many times as it was inserted. Values are
+    // read-only: changing one in place could break the ordering.
+    class iterator {
+        private:
+        Node *node;
+        // which copy of the node's value, from 0 to count - 1
+        size_t index;
+        const BSTMultiset<T, Comparator, Balance, Allocator> *set;
+
+        friend class BSTMultiset<T, Comparator, Balance, Allocator>;
+
+        public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        iterator(void) : node(nullptr), index(0), set(nullptr) {}
+        iterator(Node *node, size_t index, const BSTMultiset<T, Comparator, Balance, Allocator> *set) : node(node), index(index), set(set) {}
+
+        reference operator*(void) const { return node->getValue().value; }
+        pointer operator->(void) const { return &node->getValue().value; }
+
+        iterator& operator++(void);
+        iterator operator++(int) { iterator old = *this; ++(*this); return old; }
+        // decrementing end() yields the last copy of the maximum
+        iterator& operator--(void);
+        iterator operator--(int) { iterator old = *this; --(*this); return old; }
+
+        bool operator==(const iterator &rhs) const { return node == rhs.node && index == rhs.index; }
+        bool operator!=(const iterator &rhs) const { return !(*this == rhs); }
+    };
+    typedef iterator const_iterator;
+
+
+    // default constructor
+    BSTMultiset(Comparator comparator = Comparator(), const Allocator &allocator = Allocator());
+
+
+    // range constructor; inserts every value of [first, last)
+    template<class InputIt>
+    BSTMultiset(InputIt first, InputIt last, Comparator comparator = Comparator(), const Allocator &allocator = Allocator());
+
+
+    // checks if is empty
+    bool empty(void) const;
+
+
+    // size; the number of values, counting every copy
+    size_t size(void) const;
+
+
+    // distinct_size; the number of distinct values, which is the number of nodes
+    size_t distinct_size(void) const;
+
+
+    // clear; removes every value
+    void clear(void);
+
+
+    // insert
+    // adds a copy of value, increasing the count of an equal value if there is one; returns the new copy
+    iterator insert(const T &value);
+
+
+    // count; the number of copies of value, in O(height)
+    size_t count(const T &value) const;
+
+
+    // contains
+    bool contains(const T &value) const;
+
+
+    // find; the first copy of value, end() if there is none
+    iterator find(const T &value) const;
+
+
+    // lower_bound; the first copy of the first value that is not less than value, end() if there is none
+    iterator lower_bound(const T &value) const;
+
+
+    // upper_bound; the first copy of the first value that is greater than value, end() if there is none
+    iterator upper_bound(const T &value) const;
+
+
+    // erase_one; removes one copy of value, returns false if there was none
+    bool erase_one(const T &value);
+
+
+    // erase_all; removes every copy of value, returns how many there were
+    size_t erase_all(const T &value);
+
+
+    // erase; removes the copy at position, returns the position after it
+    // throws std::invalid_argument if position is end()
+    iterator erase(iterator position);
+
+
+    // visitDistinct; calls visit(value, count) on every distinct value in order
+    template<class Visitor>
+    void visitDistinct(Visitor visit) const;
+
+
+    // iterators, in order
+    iterator begin(void) const;
+    iterator end(void) const;
+};
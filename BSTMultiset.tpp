@@ -0,0 +1,304 @@
+/*
+BSTMultiset.tpp
+A file that contains the implementation of the BSTMultiset class methods in the BSTMultiset.hpp file.
+*/
+
+#pragma once
+
+#include "BSTMultiset.hpp"
+#include <stdexcept>
+
+using namespace std;
+
+// Increment operator.
+// Description: This function moves to the next copy of the same value, or to the first copy of the next value.
+// Parameters: NONE.
+// Return value: this iterator.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+typename BSTMultiset<T,Comparator,Balance,Allocator>::iterator& BSTMultiset<T,Comparator,Balance,Allocator>::iterator::operator++(void){
+    index++;
+    if (index == node->getValue().count){
+        node = node->successor();
+        index = 0;
+    }
+    return *this;
+}
+
+// Decrement operator.
+// Description: This function moves to the previous copy of the same value, or to the last copy of the previous
+// value; end() moves to the last copy of the maximum.
+// Parameters: NONE.
+// Return value: this iterator.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+typename BSTMultiset<T,Comparator,Balance,Allocator>::iterator& BSTMultiset<T,Comparator,Balance,Allocator>::iterator::operator--(void){
+    if (node != nullptr && index > 0){
+        index--;
+        return *this;
+    }
+    node = (node == nullptr) ? set->tree.root->treeMax() : node->predecessor();
+    index = node->getValue().count - 1;
+    return *this;
+}
+
+// Default constructor.
+// Description: This function constructs an empty multiset.
+// Parameters: the comparator, the allocator.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+BSTMultiset<T,Comparator,Balance,Allocator>::BSTMultiset(Comparator comparator, const Allocator &allocator)
+    : tree(EntryComparator{comparator}, EntryAllocator(allocator)), comparator(comparator){
+    numValues = 0;
+}
+
+// Range constructor.
+// Description: This function constructs a multiset holding the values in [first, last).
+// Parameters: the range of values, the comparator, the allocator.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+template<class InputIt>
+BSTMultiset<T,Comparator,Balance,Allocator>::BSTMultiset(InputIt first, InputIt last, Comparator comparator, const Allocator &allocator)
+    : tree(EntryComparator{comparator}, EntryAllocator(allocator)), comparator(comparator){
+    numValues = 0;
+    for (; first != last; ++first){
+        insert(*first);
+    }
+}
+
+// Checks if is empty.
+// Description: This function checks if the multiset is empty.
+// Parameters: NONE.
+// Return value: true if the multiset is empty, and false otherwise.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+bool BSTMultiset<T,Comparator,Balance,Allocator>::empty(void) const{
+    return numValues == 0;
+}
+
+// Size.
+// Description: This function returns the number of values, counting every copy.
+// Parameters: NONE.
+// Return value: the number of values.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+size_t BSTMultiset<T,Comparator,Balance,Allocator>::size(void) const{
+    return numValues;
+}
+
+// Distinct size.
+// Description: This function returns the number of distinct values, one per node.
+// Parameters: NONE.
+// Return value: the number of distinct values.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+size_t BSTMultiset<T,Comparator,Balance,Allocator>::distinct_size(void) const{
+    return tree.size();
+}
+
+// Clear function.
+// Description: This function removes every value.
+// Parameters: NONE.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+void BSTMultiset<T,Comparator,Balance,Allocator>::clear(void){
+    tree.deleteSubTree(tree.root);
+    tree.root = NULL;
+    tree.numNodes = 0;
+    numValues = 0;
+}
+
+// Lower bound node function.
+// Description: This function descends from the root with one comparison per level, remembering the last node
+// where it turned left.
+// Parameters: a value; whether to skip a node with an equal value.
+// Return value: the first node not less than value (greater than value if strict), or NULL if there is none.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+typename BSTMultiset<T,Comparator,Balance,Allocator>::Node* BSTMultiset<T,Comparator,Balance,Allocator>::lowerBoundNode(const T &value, bool strict) const{
+    Node *candidate = NULL;
+    Node *current = tree.root;
+    while (current != NULL){
+        // value <= current for lower_bound, and not current <= value (that is, value < current) for upper_bound
+        bool goLeft = strict ? !comparator(current->getValue().value, value) : comparator(value, current->getValue().value);
+        if (goLeft){
+            candidate = current;
+            current = current->getLeftChild();
+        }
+        else{
+            current = current->getRightChild();
+        }
+    }
+    return candidate;
+}
+
+// Find node function.
+// Description: This function finds the lower bound and checks it for equality once.
+// Parameters: a value.
+// Return value: the node holding value, or NULL if there is none.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+typename BSTMultiset<T,Comparator,Balance,Allocator>::Node* BSTMultiset<T,Comparator,Balance,Allocator>::findNode(const T &value) const{
+    Node *candidate = lowerBoundNode(value, false);
+    // candidate is not less than value, so it is equal if it is also <= value
+    if (candidate != NULL && comparator(candidate->getValue().value, value)){
+        return candidate;
+    }
+    return NULL;
+}
+
+// Insert function.
+// Description: This function descends once, as lower_bound does, keeping track of where a new leaf would go. If
+// the lower bound holds an equal value its count goes up; otherwise a node is linked where the descent ended.
+// Parameters: a value to be inserted.
+// Return value: an iterator to the new copy, the last one of its value.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+typename BSTMultiset<T,Comparator,Balance,Allocator>::iterator BSTMultiset<T,Comparator,Balance,Allocator>::insert(const T &value){
+    Node *candidate = NULL;
+    Node *parent = NULL;
+    Node *current = tree.root;
+    bool goLeft = false;
+    while (current != NULL){
+        parent = current;
+        goLeft = comparator(value, current->getValue().value);
+        if (goLeft){
+            candidate = current;
+            current = current->getLeftChild();
+        }
+        else{
+            current = current->getRightChild();
+        }
+    }
+    numValues++;
+    if (candidate != NULL && comparator(candidate->getValue().value, value)){
+        candidate->getValue().count++;
+        return iterator(candidate, candidate->getValue().count - 1, this);
+    }
+    Node *node = tree.emplaceNode(value, 1);
+    tree.linkNode(parent, node, goLeft);
+    return iterator(node, 0, this);
+}
+
+// Count function.
+// Description: This function returns how many copies of a value there are.
+// Parameters: a value.
+// Return value: the count of value, 0 if it is absent.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+size_t BSTMultiset<T,Comparator,Balance,Allocator>::count(const T &value) const{
+    Node *node = findNode(value);
+    return (node == NULL) ? 0 : node->getValue().count;
+}
+
+// Contains function.
+// Description: This function checks if there is a copy of a value.
+// Parameters: a value.
+// Return value: true if the value is found, and false otherwise.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+bool BSTMultiset<T,Comparator,Balance,Allocator>::contains(const T &value) const{
+    return findNode(value) != NULL;
+}
+
+// Find function.
+// Description: This function finds the first copy of a value.
+// Parameters: a value.
+// Return value: an iterator to the first copy, or end() if the value is absent.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+typename BSTMultiset<T,Comparator,Balance,Allocator>::iterator BSTMultiset<T,Comparator,Balance,Allocator>::find(const T &value) const{
+    return iterator(findNode(value), 0, this);
+}
+
+// Lower bound function.
+// Description: This function finds the first value that is not less than the given one.
+// Parameters: a value.
+// Return value: an iterator to its first copy, or end() if every value is less than the given one.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+typename BSTMultiset<T,Comparator,Balance,Allocator>::iterator BSTMultiset<T,Comparator,Balance,Allocator>::lower_bound(const T &value) const{
+    return iterator(lowerBoundNode(value, false), 0, this);
+}
+
+// Upper bound function.
+// Description: This function finds the first value that is greater than the given one.
+// Parameters: a value.
+// Return value: an iterator to its first copy, or end() if no value is greater than the given one.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+typename BSTMultiset<T,Comparator,Balance,Allocator>::iterator BSTMultiset<T,Comparator,Balance,Allocator>::upper_bound(const T &value) const{
+    return iterator(lowerBoundNode(value, true), 0, this);
+}
+
+// Erase one function.
+// Description: This function removes one copy of a value, and its node along with the last copy.
+// Parameters: a value.
+// Return value: true if a copy was removed, false if the value was absent.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+bool BSTMultiset<T,Comparator,Balance,Allocator>::erase_one(const T &value){
+    Node *node = findNode(value);
+    if (node == NULL){
+        return false;
+    }
+    if (--node->getValue().count == 0){
+        tree.erase(node);
+    }
+    numValues--;
+    return true;
+}
+
+// Erase all function.
+// Description: This function removes every copy of a value at once, with a single node removal.
+// Parameters: a value.
+// Return value: the number of copies removed.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+size_t BSTMultiset<T,Comparator,Balance,Allocator>::erase_all(const T &value){
+    Node *node = findNode(value);
+    if (node == NULL){
+        return 0;
+    }
+    size_t removed = node->getValue().count;
+    tree.erase(node);
+    numValues -= removed;
+    return removed;
+}
+
+// Erase function.
+// Description: This function removes the copy an iterator points at. Copies of a value are interchangeable, so
+// the last one is the one taken away; the nodes of other values are never moved, so other iterators stay valid.
+// Parameters: an iterator to a copy.
+// Return value: an iterator to the copy that followed it.
+// throws std::invalid_argument if position is end().
+template<class T, typename Comparator, typename Balance, typename Allocator>
+typename BSTMultiset<T,Comparator,Balance,Allocator>::iterator BSTMultiset<T,Comparator,Balance,Allocator>::erase(iterator position){
+    if (position.node == NULL){
+        throw invalid_argument("Can not erase end()");
+    }
+    Node *node = position.node;
+    numValues--;
+    if (--node->getValue().count > position.index){
+        return position;
+    }
+    Node *next = node->successor();
+    if (node->getValue().count == 0){
+        tree.erase(node);
+    }
+    return iterator(next, 0, this);
+}
+
+// Distinct visitor.
+// Description: This function calls visit(value, count) on every distinct value in order, without expanding the
+// copies.
+// Parameters: the visitor.
+// Return value: NONE.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+template<class Visitor>
+void BSTMultiset<T,Comparator,Balance,Allocator>::visitDistinct(Visitor visit) const{
+    tree.visitInOrder([&visit](const Entry &entry){ visit(entry.value, entry.count); });
+}
+
+// Begin.
+// Description: This function returns an iterator to the first copy of the smallest value.
+// Parameters: NONE.
+// Return value: an iterator to the first value, or end() if the multiset is empty.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+typename BSTMultiset<T,Comparator,Balance,Allocator>::iterator BSTMultiset<T,Comparator,Balance,Allocator>::begin(void) const{
+    return iterator(tree.root == NULL ? NULL : tree.root->treeMin(), 0, this);
+}
+
+// End.
+// Description: This function returns the past-the-end iterator.
+// Parameters: NONE.
+// Return value: an iterator that points at no value.
+template<class T, typename Comparator, typename Balance, typename Allocator>
+typename BSTMultiset<T,Comparator,Balance,Allocator>::iterator BSTMultiset<T,Comparator,Balance,Allocator>::end(void) const{
+    return iterator(NULL, 0, this);
+}
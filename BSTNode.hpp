@@ -11,6 +11,12 @@ Description: Header file for the BSTNode<> templated class
 // include your DoublyLinkedList files from Project 1!
 #include "DoublyLinkedList.hpp"
 #include "DoublyLinkedList.tpp"
+#include <type_traits>
+#include <utility>
+
+
+template<class T, typename Comparator, typename Balance, typename Allocator, typename Stats>
+class BST;
 
 
 template<class T>
@@ -20,18 +26,27 @@ class BSTNode {
     T value;
     BSTNode<T> *parent, *left, *right;
 
+    // the tree links and unlinks nodes directly
+    template<class U, typename Comparator, typename Balance, typename Allocator, typename Stats>
+    friend class BST;
+
     public:
 
     // default constructor
-    BSTNode<T>(void);
+    BSTNode(void);
 
 
     // value constructor
-    BSTNode<T>(T value);
+    BSTNode(const T &value);
+
+
+    // in-place constructor; constructs the value from args
+    template<class... Args>
+    BSTNode(std::in_place_t, Args&&... args);
 
 
     //copy constructor
-    BSTNode<T>(const BSTNode<T> &node);
+    BSTNode(const BSTNode<T> &node);
 
 
     //assignment operator
@@ -62,11 +77,11 @@ class BSTNode {
     void nullifyParent(void);
 
 
-    //setLeft
+    //setLeft; also sets the parent of node to this node
     void setLeftChild(BSTNode<T> *node);
 
 
-    //setRight
+    //setRight; also sets the parent of node to this node
     void setRightChild(BSTNode<T> *node);
 
 
@@ -78,6 +93,24 @@ class BSTNode {
     BSTNode<T>* treeMax(void);
 
 
+    //successor; the next node in order, or nullptr if this node holds the maximum
+    BSTNode<T>* successor(void);
+
+
+    //predecessor; the previous node in order, or nullptr if this node holds the minimum
+    BSTNode<T>* predecessor(void);
+
+
+    //rotateLeft; the right child takes this node's place, root is updated if this node was the root
+    //returns the new root of the rotated subtree; only the links change (see BSTAugmentedNode::rotateLeft)
+    BSTNode<T>* rotateLeft(BSTNode<T>* &root);
+
+
+    //rotateRight; the left child takes this node's place, root is updated if this node was the root
+    //returns the new root of the rotated subtree; only the links change
+    BSTNode<T>* rotateRight(BSTNode<T>* &root);
+
+
     // preorder
     DoublyLinkedList<T> getPreOrderTraversal(void) const;
 
@@ -90,6 +123,87 @@ class BSTNode {
     DoublyLinkedList<T> getPostOrderTraversal(void) const;
 
 
+    // visitors; call visit(value) on every value of the subtree in the given order
+    // the walks follow the parent pointers, so they need neither recursion nor extra memory
+    template<class Visitor>
+    void visitPreOrder(Visitor visit) const;
+
+
+    template<class Visitor>
+    void visitInOrder(Visitor visit) const;
+
+
+    template<class Visitor>
+    void visitPostOrder(Visitor visit) const;
+
+
     //destructor
-    ~BSTNode<T>(void);
+    ~BSTNode(void);
+};
+
+
+/*
+The nodes a BST<> allocates. Balancing policies that need more than the links per node say so with their
+tracksHeight, tracksSize and tracksAccesses flags (see BSTBalance.hpp), and the tree stores exactly those fields:
+with none, a node is as large as a BSTNode<T>. The tree still hands out BSTNode<T>* handles; code that knows the tree's
+policy can cast them to BST<>::Node to read the fields.
+*/
+template<class T, bool KeepsHeight, bool KeepsSize, bool KeepsAccesses>
+class BSTAugmentedNode : public BSTNode<T> {
+    private:
+    // stand-ins that take no space for the fields the policy does not keep
+    struct NoHeight {};
+    struct NoSize {};
+    struct NoAccesses {};
+
+    // number of nodes in the subtree rooted at this node
+    [[no_unique_address]] typename std::conditional<KeepsSize, size_t, NoSize>::type subtreeSize;
+    // height of the subtree rooted at this node (a leaf has height 1)
+    [[no_unique_address]] typename std::conditional<KeepsHeight, int, NoHeight>::type height;
+    // number of lookups that ended on this node
+    [[no_unique_address]] typename std::conditional<KeepsAccesses, size_t, NoAccesses>::type accesses;
+
+    // the tree adjusts the fields directly in insert and erase
+    template<class U, typename Comparator, typename Balance, typename Allocator, typename Stats>
+    friend class BST;
+
+    public:
+    // value constructor
+    BSTAugmentedNode(const T &value);
+
+
+    // in-place constructor; constructs the value from args
+    template<class... Args>
+    BSTAugmentedNode(std::in_place_t, Args&&... args);
+
+
+    //getHeight
+    int getHeight(void) const;
+
+
+    //getSubtreeSize
+    size_t getSubtreeSize(void) const;
+
+
+    //getAccesses
+    size_t getAccesses(void) const;
+
+
+    // height and size of the subtree rooted at node, which may be nullptr
+    static int heightOf(BSTNode<T> *node);
+    static size_t sizeOf(BSTNode<T> *node);
+
+
+    // recordAccess; counts one more lookup ending on node, returns the new count
+    static size_t recordAccess(BSTNode<T> *node);
+
+
+    // update; recomputes the fields that are kept from the children of node
+    static void update(BSTNode<T> *node);
+
+
+    // rotations; relink like BSTNode<T>::rotateLeft and BSTNode<T>::rotateRight, then update the two nodes
+    // whose subtrees changed
+    static BSTNode<T>* rotateLeft(BSTNode<T>* &root, BSTNode<T> *node);
+    static BSTNode<T>* rotateRight(BSTNode<T>* &root, BSTNode<T> *node);
 };
@@ -26,8 +26,18 @@ BSTNode<T>::BSTNode(void) {
 // Parameter: A value to be assigned to the node.
 // Return value: NONE.
 template <class T>
-BSTNode<T>::BSTNode(T value) {
-    this->value = value;
+BSTNode<T>::BSTNode(const T &value) : value(value) {
+    parent = nullptr;
+    left = nullptr;
+    right = nullptr;
+}
+
+// In-place constructor.
+// Parameter: The arguments the value is constructed from.
+// Return value: NONE.
+template <class T>
+template <class... Args>
+BSTNode<T>::BSTNode(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...) {
     parent = nullptr;
     left = nullptr;
     right = nullptr;
@@ -37,8 +47,7 @@ BSTNode<T>::BSTNode(T value) {
 // Parameter: A given BSTNode.
 // Return value: NONE.
 template <class T>
-BSTNode<T>::BSTNode(const BSTNode<T> &node) {
-    this->value = node.value;
+BSTNode<T>::BSTNode(const BSTNode<T> &node) : value(node.value) {
     this->parent = node.parent;
     this->left = node.left;
     this->right = node.right;
@@ -108,19 +117,27 @@ void BSTNode<T>::nullifyParent(void) {
 }
 
 // Set left child.
-// Parameter: A pointer to a new node. This sets the left child of the node to this new node. 
+// Parameter: A pointer to a new node. This sets the left child of the node to this new node, and makes this node
+// its parent, which the walks and successor/predecessor follow.
 // Return value: NONE.
 template <class T>
 void BSTNode<T>::setLeftChild(BSTNode<T> *node) {
     left = node;
+    if (node != nullptr) {
+        node->parent = this;
+    }
 }
 
 // Set right child.
-// Parameter: A pointer to a new node. This sets the right child of the node to this new node.
+// Parameter: A pointer to a new node. This sets the right child of the node to this new node, and makes this node
+// its parent.
 // Return value: NONE.
 template <class T>
 void BSTNode<T>::setRightChild(BSTNode<T> *node) {
     right = node;
+    if (node != nullptr) {
+        node->parent = this;
+    }
 }
 
 // Get minimum value in its subtree.
@@ -147,21 +164,89 @@ BSTNode<T>* BSTNode<T>::treeMax(void) {
     return current;
 }
 
-// Preorder traversal.
+// Successor.
 // Parameter: NONE.
-// Return value: A DoublyLinkedList of the values in the subtree in which the node is the root, in preorder.
+// Return value: The node that follows this one in order, or nullptr if this node holds the maximum of the tree.
 template <class T>
-DoublyLinkedList<T> BSTNode<T>::getPreOrderTraversal(void) const {
-    DoublyLinkedList<T> list;
-    list.push_back(this->value);
+BSTNode<T>* BSTNode<T>::successor(void) {
+    if (right != nullptr) {
+        return right->treeMin();
+    }
+    BSTNode<T> *current = this;
+    while (current->parent != nullptr && current->parent->right == current) {
+        current = current->parent;
+    }
+    return current->parent;
+}
+
+// Predecessor.
+// Parameter: NONE.
+// Return value: The node that precedes this one in order, or nullptr if this node holds the minimum of the tree.
+template <class T>
+BSTNode<T>* BSTNode<T>::predecessor(void) {
     if (left != nullptr) {
-        DoublyLinkedList<T> leftList = left->getPreOrderTraversal();
-        list = list.concatenate(leftList);
+        return left->treeMax();
+    }
+    BSTNode<T> *current = this;
+    while (current->parent != nullptr && current->parent->left == current) {
+        current = current->parent;
     }
+    return current->parent;
+}
+
+// Rotate left.
+// Parameter: The root pointer of the tree the node belongs to; it is updated if the node was the root.
+// Return value: The right child, which is now the root of the rotated subtree. Only the links are changed.
+template <class T>
+BSTNode<T>* BSTNode<T>::rotateLeft(BSTNode<T>* &root) {
+    BSTNode<T> *pivot = right;
+    right = pivot->left;
     if (right != nullptr) {
-        DoublyLinkedList<T> rightList = right->getPreOrderTraversal();
-        list = list.concatenate(rightList);
+        right->parent = this;
+    }
+    pivot->parent = parent;
+    if (parent == nullptr) {
+        root = pivot;
+    } else if (parent->left == this) {
+        parent->left = pivot;
+    } else {
+        parent->right = pivot;
+    }
+    pivot->left = this;
+    parent = pivot;
+    return pivot;
+}
+
+// Rotate right.
+// Parameter: The root pointer of the tree the node belongs to; it is updated if the node was the root.
+// Return value: The left child, which is now the root of the rotated subtree. Only the links are changed.
+template <class T>
+BSTNode<T>* BSTNode<T>::rotateRight(BSTNode<T>* &root) {
+    BSTNode<T> *pivot = left;
+    left = pivot->right;
+    if (left != nullptr) {
+        left->parent = this;
     }
+    pivot->parent = parent;
+    if (parent == nullptr) {
+        root = pivot;
+    } else if (parent->left == this) {
+        parent->left = pivot;
+    } else {
+        parent->right = pivot;
+    }
+    pivot->right = this;
+    parent = pivot;
+    return pivot;
+}
+
+// Preorder traversal.
+// Parameter: NONE.
+// Return value: A DoublyLinkedList of the values in the subtree in which the node is the root, in preorder.
+template <class T>
+DoublyLinkedList<T> BSTNode<T>::getPreOrderTraversal(void) const {
+    DoublyLinkedList<T> list;
+    visitPreOrder([&list](const T &value) { list.push_back(value); });
     return list;
 }
 
@@ -171,15 +256,7 @@ DoublyLinkedList<T> BSTNode<T>::getPreOrderTraversal(void) const {
 template <class T>
 DoublyLinkedList<T> BSTNode<T>::getInOrderTraversal(void) const {
     DoublyLinkedList<T> list;
-    if (left != nullptr) {
-        DoublyLinkedList<T> leftList = left->getInOrderTraversal();
-        list = list.concatenate(leftList);
-    }
-    list.push_back(this->value);
-    if (right != nullptr) {
-        DoublyLinkedList<T> rightList = right->getInOrderTraversal();
-        list = list.concatenate(rightList);
-    }
+    visitInOrder([&list](const T &value) { list.push_back(value); });
     return list;
 }
 
@@ -189,16 +266,92 @@ DoublyLinkedList<T> BSTNode<T>::getInOrderTraversal(void) const {
 template <class T>
 DoublyLinkedList<T> BSTNode<T>::getPostOrderTraversal(void) const {
     DoublyLinkedList<T> list;
-    if (left != nullptr) {
-        DoublyLinkedList<T> leftList = left->getPostOrderTraversal();
-        list = list.concatenate(leftList);
+    visitPostOrder([&list](const T &value) { list.push_back(value); });
+    return list;
+}
+
+// Preorder visitor.
+// Parameter: A callable invoked with each value of the subtree in which the node is the root, in preorder.
+// Return value: NONE.
+template <class T>
+template <class Visitor>
+void BSTNode<T>::visitPreOrder(Visitor visit) const {
+    const BSTNode<T> *current = this;
+    while (current != nullptr) {
+        visit(current->value);
+        if (current->left != nullptr) {
+            current = current->left;
+        } else if (current->right != nullptr) {
+            current = current->right;
+        } else {
+            // Climb until we leave a left subtree whose parent still has a right subtree to visit.
+            const BSTNode<T> *next = nullptr;
+            while (current != this) {
+                const BSTNode<T> *up = current->parent;
+                if (up->left == current && up->right != nullptr) {
+                    next = up->right;
+                    break;
+                }
+                current = up;
+            }
+            current = next;
+        }
     }
-    if (right != nullptr) {
-        DoublyLinkedList<T> rightList = right->getPostOrderTraversal();
-        list = list.concatenate(rightList);
+}
+
+// Inorder visitor.
+// Parameter: A callable invoked with each value of the subtree in which the node is the root, in inorder.
+// Return value: NONE.
+template <class T>
+template <class Visitor>
+void BSTNode<T>::visitInOrder(Visitor visit) const {
+    const BSTNode<T> *current = this;
+    while (current->left != nullptr) {
+        current = current->left;
+    }
+    while (current != nullptr) {
+        visit(current->value);
+        if (current->right != nullptr) {
+            current = current->right;
+            while (current->left != nullptr) {
+                current = current->left;
+            }
+        } else {
+            // Climb out of right subtrees; the first ancestor reached from the left is next.
+            while (current != this && current->parent->right == current) {
+                current = current->parent;
+            }
+            current = (current == this) ? nullptr : current->parent;
+        }
+    }
+}
+
+// Postorder visitor.
+// Parameter: A callable invoked with each value of the subtree in which the node is the root, in postorder.
+// Return value: NONE.
+template <class T>
+template <class Visitor>
+void BSTNode<T>::visitPostOrder(Visitor visit) const {
+    // The first node in postorder is the first leaf reached by preferring left children.
+    const BSTNode<T> *current = this;
+    while (current->left != nullptr || current->right != nullptr) {
+        current = (current->left != nullptr) ? current->left : current->right;
+    }
+    while (true) {
+        visit(current->value);
+        if (current == this) {
+            return;
+        }
+        const BSTNode<T> *up = current->parent;
+        if (up->left == current && up->right != nullptr) {
+            current = up->right;
+            while (current->left != nullptr || current->right != nullptr) {
+                current = (current->left != nullptr) ? current->left : current->right;
+            }
+        } else {
+            current = up;
+        }
     }
-    list.push_back(this->value);
-    return list;
 }
 
 // Destructor.
@@ -211,3 +364,129 @@ BSTNode<T>::~BSTNode(void) {
     // This is because the nodes are dynamically allocated.
     // If we delete the nodes here, it will cause a double deletion error.
 }
+
+// Augmented node, value constructor.
+// Parameter: A value to be assigned to the node.
+// Return value: NONE.
+template <class T, bool KeepsHeight, bool KeepsSize, bool KeepsAccesses>
+BSTAugmentedNode<T, KeepsHeight, KeepsSize, KeepsAccesses>::BSTAugmentedNode(const T &value) : BSTNode<T>(value) {
+    if constexpr (KeepsSize) {
+        subtreeSize = 1;
+    }
+    if constexpr (KeepsHeight) {
+        height = 1;
+    }
+    if constexpr (KeepsAccesses) {
+        accesses = 0;
+    }
+}
+
+// Augmented node, in-place constructor.
+// Parameter: The arguments the value is constructed from.
+// Return value: NONE.
+template <class T, bool KeepsHeight, bool KeepsSize, bool KeepsAccesses>
+template <class... Args>
+BSTAugmentedNode<T, KeepsHeight, KeepsSize, KeepsAccesses>::BSTAugmentedNode(std::in_place_t, Args&&... args)
+    : BSTNode<T>(in_place, std::forward<Args>(args)...) {
+    if constexpr (KeepsSize) {
+        subtreeSize = 1;
+    }
+    if constexpr (KeepsHeight) {
+        height = 1;
+    }
+    if constexpr (KeepsAccesses) {
+        accesses = 0;
+    }
+}
+
+// Get height.
+// Parameter: NONE.
+// Return value: The height of the subtree in which the node is the root (a leaf has height 1).
+template <class T, bool KeepsHeight, bool KeepsSize, bool KeepsAccesses>
+int BSTAugmentedNode<T, KeepsHeight, KeepsSize, KeepsAccesses>::getHeight(void) const {
+    static_assert(KeepsHeight, "the tree's policy does not keep heights");
+    return height;
+}
+
+// Get subtree size.
+// Parameter: NONE.
+// Return value: The number of nodes in the subtree in which the node is the root.
+template <class T, bool KeepsHeight, bool KeepsSize, bool KeepsAccesses>
+size_t BSTAugmentedNode<T, KeepsHeight, KeepsSize, KeepsAccesses>::getSubtreeSize(void) const {
+    static_assert(KeepsSize, "the tree's policy does not keep subtree sizes, e.g. use OrderStatistics<>");
+    return subtreeSize;
+}
+
+// Get accesses.
+// Parameter: NONE.
+// Return value: The number of lookups that ended on the node.
+template <class T, bool KeepsHeight, bool KeepsSize, bool KeepsAccesses>
+size_t BSTAugmentedNode<T, KeepsHeight, KeepsSize, KeepsAccesses>::getAccesses(void) const {
+    static_assert(KeepsAccesses, "the tree's policy does not count accesses");
+    return accesses;
+}
+
+// Height of.
+// Parameter: A node of a tree made of these nodes, or nullptr.
+// Return value: The height of the subtree in which node is the root, 0 for nullptr.
+template <class T, bool KeepsHeight, bool KeepsSize, bool KeepsAccesses>
+int BSTAugmentedNode<T, KeepsHeight, KeepsSize, KeepsAccesses>::heightOf(BSTNode<T> *node) {
+    return (node != nullptr) ? static_cast<BSTAugmentedNode *>(node)->getHeight() : 0;
+}
+
+// Size of.
+// Parameter: A node of a tree made of these nodes, or nullptr.
+// Return value: The number of nodes in the subtree in which node is the root, 0 for nullptr.
+template <class T, bool KeepsHeight, bool KeepsSize, bool KeepsAccesses>
+size_t BSTAugmentedNode<T, KeepsHeight, KeepsSize, KeepsAccesses>::sizeOf(BSTNode<T> *node) {
+    return (node != nullptr) ? static_cast<BSTAugmentedNode *>(node)->getSubtreeSize() : 0;
+}
+
+// Record access.
+// Parameter: A node of a tree made of these nodes.
+// Return value: The number of lookups that ended on node, this one included.
+template <class T, bool KeepsHeight, bool KeepsSize, bool KeepsAccesses>
+size_t BSTAugmentedNode<T, KeepsHeight, KeepsSize, KeepsAccesses>::recordAccess(BSTNode<T> *node) {
+    static_assert(KeepsAccesses, "the tree's policy does not count accesses");
+    return ++static_cast<BSTAugmentedNode *>(node)->accesses;
+}
+
+// Update.
+// Parameter: A node of a tree made of these nodes.
+// Return value: NONE. The fields that are kept are recomputed from the ones stored in the children; a node that
+// keeps neither is left alone.
+template <class T, bool KeepsHeight, bool KeepsSize, bool KeepsAccesses>
+void BSTAugmentedNode<T, KeepsHeight, KeepsSize, KeepsAccesses>::update(BSTNode<T> *node) {
+    BSTAugmentedNode *augmented = static_cast<BSTAugmentedNode *>(node);
+    if constexpr (KeepsSize) {
+        augmented->subtreeSize = 1 + sizeOf(node->getLeftChild()) + sizeOf(node->getRightChild());
+    }
+    if constexpr (KeepsHeight) {
+        int leftHeight = heightOf(node->getLeftChild());
+        int rightHeight = heightOf(node->getRightChild());
+        augmented->height = 1 + ((leftHeight > rightHeight) ? leftHeight : rightHeight);
+    }
+    (void) augmented;
+}
+
+// Augmented rotate left.
+// Parameter: The root pointer of the tree, the node to rotate.
+// Return value: The right child of node, which is now the root of the rotated subtree.
+template <class T, bool KeepsHeight, bool KeepsSize, bool KeepsAccesses>
+BSTNode<T>* BSTAugmentedNode<T, KeepsHeight, KeepsSize, KeepsAccesses>::rotateLeft(BSTNode<T>* &root, BSTNode<T> *node) {
+    BSTNode<T> *pivot = node->rotateLeft(root);
+    update(node);
+    update(pivot);
+    return pivot;
+}
+
+// Augmented rotate right.
+// Parameter: The root pointer of the tree, the node to rotate.
+// Return value: The left child of node, which is now the root of the rotated subtree.
+template <class T, bool KeepsHeight, bool KeepsSize, bool KeepsAccesses>
+BSTNode<T>* BSTAugmentedNode<T, KeepsHeight, KeepsSize, KeepsAccesses>::rotateRight(BSTNode<T>* &root, BSTNode<T> *node) {
+    BSTNode<T> *pivot = node->rotateRight(root);
+    update(node);
+    update(pivot);
+    return pivot;
+}
@@ -0,0 +1,78 @@
+/*
+File name: BSTStats.hpp
+Creation Date: 10/16/2026
+Description: Statistics policies for the BST<> templated class
+*/
+
+#pragma once
+
+#include <cstddef>
+
+/*
+A statistics policy is passed to BST<> as its fifth template parameter. The tree holds one policy object and calls
+it from insert, search, erase, the comparator and the node allocator; BST<>::stats() returns the policy's snapshot.
+
+A policy must provide the following member functions; the tree keeps its policy object mutable, so that searches
+of a const tree are counted too:
+    countComparison(): called once per call to the tree's comparator
+    recordInsert(depth): a value was linked as a leaf after visiting depth nodes
+    recordSearch(depth): a search, lower_bound or upper_bound descent visited depth nodes
+    recordErase(twoChildren): a node was erased; twoChildren if its successor had to be moved into its place
+    recordAllocations(count), recordDeallocations(count): nodes obtained from or returned to the allocator
+    snapshot(): the values collected so far, as a copyable Snapshot
+*/
+
+
+// Default policy: every hook is empty and the object takes no space in the tree, so nothing is collected or paid.
+struct NoStats {
+    struct Snapshot {};
+
+    void countComparison(void);
+    void recordInsert(size_t depth);
+    void recordSearch(size_t depth);
+    void recordErase(bool twoChildren);
+    void recordAllocations(size_t count);
+    void recordDeallocations(size_t count);
+    Snapshot snapshot(void) const;
+};
+
+
+// Counting policy: plain counters and depth histograms, one increment per event, e.g.
+// BST<int, std::less_equal<int>, AVLBalance, PoolAllocator<int>, CountingStats>. Not synchronized, as the tree.
+struct CountingStats {
+    // histogram bucket k counts the operations that visited between 2^(k-1) and 2^k - 1 nodes (bucket 0: none);
+    // deeper operations land in the last bucket
+    static const size_t depthBuckets = 48;
+
+    struct Snapshot {
+        size_t inserts;
+        size_t searches;
+        size_t erases;
+        // erases of nodes with two children, where the successor is moved into the erased node's place
+        size_t twoChildErases;
+        size_t comparisons;
+        size_t allocations;
+        size_t deallocations;
+        // deepest descent seen; close to size() for a degenerate tree, close to log2(size()) for a balanced one
+        size_t maxInsertDepth;
+        size_t maxSearchDepth;
+        size_t insertDepths[depthBuckets];
+        size_t searchDepths[depthBuckets];
+    };
+
+    CountingStats(void);
+
+    void countComparison(void);
+    void recordInsert(size_t depth);
+    void recordSearch(size_t depth);
+    void recordErase(bool twoChildren);
+    void recordAllocations(size_t count);
+    void recordDeallocations(size_t count);
+    Snapshot snapshot(void) const;
+
+    // histogram bucket of a depth
+    static size_t depthBucket(size_t depth);
+
+    private:
+    Snapshot counters;
+};
@@ -0,0 +1,132 @@
+/*
+BSTStats.tpp
+A file that contains the implementation of the statistics policies in the BSTStats.hpp file.
+*/
+
+#pragma once
+
+#include "BSTStats.hpp"
+
+using namespace std;
+
+// No stats, hooks.
+// Description: Do nothing; the calls compile away.
+// Parameters: ignored.
+// Return value: NONE.
+inline void NoStats::countComparison(void){
+}
+
+inline void NoStats::recordInsert(size_t depth){
+    (void) depth;
+}
+
+inline void NoStats::recordSearch(size_t depth){
+    (void) depth;
+}
+
+inline void NoStats::recordErase(bool twoChildren){
+    (void) twoChildren;
+}
+
+inline void NoStats::recordAllocations(size_t count){
+    (void) count;
+}
+
+inline void NoStats::recordDeallocations(size_t count){
+    (void) count;
+}
+
+// No stats, snapshot.
+// Description: Returns an empty snapshot.
+// Parameters: NONE.
+// Return value: an empty snapshot.
+inline NoStats::Snapshot NoStats::snapshot(void) const{
+    return Snapshot();
+}
+
+// Counting stats, constructor.
+// Description: Starts every counter and histogram bucket at zero.
+// Parameters: NONE.
+// Return value: NONE.
+inline CountingStats::CountingStats(void) : counters(){
+}
+
+// Counting stats, count comparison.
+// Description: Counts one call to the comparator.
+// Parameters: NONE.
+// Return value: NONE.
+inline void CountingStats::countComparison(void){
+    counters.comparisons++;
+}
+
+// Counting stats, record insert.
+// Description: Counts an insert and adds its depth to the histogram.
+// Parameters: the number of nodes visited on the way down.
+// Return value: NONE.
+inline void CountingStats::recordInsert(size_t depth){
+    counters.inserts++;
+    counters.insertDepths[depthBucket(depth)]++;
+    if (depth > counters.maxInsertDepth){
+        counters.maxInsertDepth = depth;
+    }
+}
+
+// Counting stats, record search.
+// Description: Counts a search and adds its depth to the histogram.
+// Parameters: the number of nodes visited on the way down.
+// Return value: NONE.
+inline void CountingStats::recordSearch(size_t depth){
+    counters.searches++;
+    counters.searchDepths[depthBucket(depth)]++;
+    if (depth > counters.maxSearchDepth){
+        counters.maxSearchDepth = depth;
+    }
+}
+
+// Counting stats, record erase.
+// Description: Counts an erase, and separately the erases that had to move the successor.
+// Parameters: whether the erased node had two children.
+// Return value: NONE.
+inline void CountingStats::recordErase(bool twoChildren){
+    counters.erases++;
+    if (twoChildren){
+        counters.twoChildErases++;
+    }
+}
+
+// Counting stats, record allocations.
+// Description: Counts nodes obtained from the allocator.
+// Parameters: the number of nodes.
+// Return value: NONE.
+inline void CountingStats::recordAllocations(size_t count){
+    counters.allocations += count;
+}
+
+// Counting stats, record deallocations.
+// Description: Counts nodes returned to the allocator.
+// Parameters: the number of nodes.
+// Return value: NONE.
+inline void CountingStats::recordDeallocations(size_t count){
+    counters.deallocations += count;
+}
+
+// Counting stats, snapshot.
+// Description: Copies the counters collected so far.
+// Parameters: NONE.
+// Return value: the counters.
+inline CountingStats::Snapshot CountingStats::snapshot(void) const{
+    return counters;
+}
+
+// Counting stats, depth bucket.
+// Description: Maps a depth to its histogram bucket, the number of bits needed to write it.
+// Parameters: a depth.
+// Return value: the bucket, at most depthBuckets - 1.
+inline size_t CountingStats::depthBucket(size_t depth){
+    size_t bucket = 0;
+    while (depth != 0 && bucket < depthBuckets - 1){
+        depth >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
@@ -0,0 +1,243 @@
+/*
+File name: BTree.hpp
+Creation Date: 10/16/2026
+Description: Header file for the BTree<> templated class, a cache-friendly B+ tree with the operations of BST<>
+*/
+
+#pragma once
+
+#include "BST.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+
+/*
+BTree is a B+ tree: every node occupies about NodeBytes bytes (256 by default, four cache lines) and holds as
+many values as fit, so a lookup touches one node per level of a tree that is only log_B(n) levels deep, and finds
+its way inside each node with a binary search over contiguous values instead of chasing a pointer per
+comparison. Values live in the leaves, which are linked in order, so iterating is a walk over full nodes. Inner
+nodes only hold copies of values, as separators between their children.
+
+BTree offers the operations of BST<>, with the differences that come from values moving between nodes: search
+returns a pointer to the value rather than a node, and erase takes a value. Since every value is in a leaf, and
+every depth-first order visits the leaves from left to right, the preorder, inorder and postorder traversals
+list the same sequence. Duplicates are kept, after the equal values already there. The comparator follows the
+BST<> convention: comparator(a, b) is true if a <= b.
+*/
+template<class T, typename Comparator = std::less_equal<T>, size_t NodeBytes = 256, typename Allocator = PoolAllocator<T> >
+class BTree {
+    static_assert(NodeBytes >= 64, "nodes smaller than a cache line defeat the purpose");
+
+    private:
+    struct Node {
+        uint32_t count;
+        bool leaf;
+    };
+
+    // Every node can hold one value (leaves) or one separator and one child (inner nodes) beyond its capacity,
+    // so that an insertion lands first and the split happens after.
+    static constexpr size_t leafHeader = sizeof(Node) + 2 * sizeof(void*);
+    static constexpr size_t leafFit = (NodeBytes - leafHeader) / sizeof(T);
+    static constexpr size_t leafCapacity = (leafFit > 4) ? leafFit - 1 : 3;
+    // an inner node also holds one child more than it has keys; a T too large for the node gets the minimum
+    static constexpr size_t innerHeader = sizeof(Node) + sizeof(T) + 2 * sizeof(void*);
+    static constexpr size_t innerFit = (NodeBytes > innerHeader) ? (NodeBytes - innerHeader) / (sizeof(T) + sizeof(void*)) : 0;
+    static constexpr size_t innerCapacity = (innerFit > 3) ? innerFit : 3;
+
+    struct Leaf : Node {
+        Leaf *prev, *next;
+        // values[0..count), constructed as needed
+        alignas(T) unsigned char storage[(leafCapacity + 1) * sizeof(T)];
+
+        T* values(void) { return reinterpret_cast<T*>(storage); }
+        const T* values(void) const { return reinterpret_cast<const T*>(storage); }
+    };
+
+    struct Inner : Node {
+        // children[0..count]; the values in children[i] are >= keys[i - 1] and <= keys[i]
+        Node *children[innerCapacity + 2];
+        // keys[0..count), constructed as needed
+        alignas(T) unsigned char storage[(innerCapacity + 1) * sizeof(T)];
+
+        T* keys(void) { return reinterpret_cast<T*>(storage); }
+        const T* keys(void) const { return reinterpret_cast<const T*>(storage); }
+    };
+
+    // leaves and inner nodes share one slot size, so a pool serves both
+    struct alignas(Leaf) alignas(Inner) Slot {
+        unsigned char bytes[sizeof(Leaf) > sizeof(Inner) ? sizeof(Leaf) : sizeof(Inner)];
+    };
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Slot> SlotAllocator;
+    typedef std::allocator_traits<SlotAllocator> SlotAllocatorTraits;
+
+    // result of inserting into a subtree: the new right sibling if the subtree's root split, and the separator
+    // that goes between them
+    struct Split {
+        Node *right;
+        std::optional<T> separator;
+    };
+
+    Node *root;
+    // first and last leaves
+    Leaf *head, *tail;
+    size_t numValues;
+    Comparator comparator;
+    SlotAllocator allocator;
+
+    Leaf* createLeaf(void);
+    Inner* createInner(void);
+    // destroys the values or keys of a node and frees it
+    void destroyNode(Node *node);
+    void deleteSubTree(Node *node);
+    // copies a subtree, appending its leaves to the chain ending at lastLeaf
+    Node* copySubTree(const Node *node, Leaf *&lastLeaf);
+
+    // in-node searches, branch-free: the first position whose value is not less than value (lowerIndex) or is
+    // greater than value (upperIndex)
+    size_t lowerIndex(const T *values, size_t count, const T &value) const;
+    size_t upperIndex(const T *values, size_t count, const T &value) const;
+
+    // moving values around in raw storage
+    static void insertAt(T *values, size_t count, size_t position, const T &value);
+    static void eraseAt(T *values, size_t count, size_t position);
+    static void moveTo(T *from, size_t count, T *to);
+
+    Split insertInto(Node *node, const T &value);
+    Split splitLeaf(Leaf *leaf);
+    Split splitInner(Inner *inner);
+    bool eraseFrom(Node *node, const T &value);
+    // restores the minimum occupancy of child i of parent after an erase
+    void fixUnderflow(Inner *parent, size_t i);
+    // the leaf and position of the first value not less than value (greater than value if strict)
+    std::pair<const Leaf*, size_t> lowerBoundPosition(const T &value, bool strict) const;
+
+
+    public:
+    // Bidirectional iterator over the values in order, stepping through the linked leaves. Values are read-only:
+    // changing one in place could break the ordering. Inserting or erasing invalidates every iterator.
+    class iterator {
+        private:
+        const Leaf *leaf;
+        size_t index;
+        const BTree<T, Comparator, NodeBytes, Allocator> *tree;
+
+        public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        iterator(void) : leaf(nullptr), index(0), tree(nullptr) {}
+        iterator(const Leaf *leaf, size_t index, const BTree<T, Comparator, NodeBytes, Allocator> *tree) : leaf(leaf), index(index), tree(tree) {}
+
+        reference operator*(void) const { return leaf->values()[index]; }
+        pointer operator->(void) const { return &leaf->values()[index]; }
+
+        iterator& operator++(void);
+        iterator operator++(int) { iterator old = *this; ++(*this); return old; }
+        // decrementing end() yields the maximum
+        iterator& operator--(void);
+        iterator operator--(int) { iterator old = *this; --(*this); return old; }
+
+        bool operator==(const iterator &rhs) const { return leaf == rhs.leaf && index == rhs.index; }
+        bool operator!=(const iterator &rhs) const { return !(*this == rhs); }
+    };
+    typedef iterator const_iterator;
+
+
+    // number of values a leaf holds, and of separators an inner node holds, when full
+    static constexpr size_t leafFanout = leafCapacity;
+    static constexpr size_t innerFanout = innerCapacity;
+
+
+    // default constructor
+    BTree(Comparator comparator = Comparator(), const Allocator &allocator = Allocator());
+
+
+    // copy constructor
+    BTree(const BTree<T, Comparator, NodeBytes, Allocator> &tree);
+
+
+    // move constructor; tree is left empty, with a new allocator (with PoolAllocator, a pool of its own), so it can
+    // be reused on another thread and this tree's pool stays unshared
+    BTree(BTree<T, Comparator, NodeBytes, Allocator> &&tree) noexcept;
+
+
+    // assignment operator
+    BTree<T, Comparator, NodeBytes, Allocator>& operator=(const BTree<T, Comparator, NodeBytes, Allocator> &tree);
+
+
+    // move assignment operator; swaps the contents
+    BTree<T, Comparator, NodeBytes, Allocator>& operator=(BTree<T, Comparator, NodeBytes, Allocator> &&tree) noexcept;
+
+
+    // destructor
+    ~BTree(void);
+
+
+    // checks if is empty
+    bool empty(void) const;
+
+
+    // size
+    size_t size(void) const;
+
+
+    // get_allocator; a copy of the allocator of the nodes, rebound to T
+    Allocator get_allocator(void) const;
+
+
+    // height; the number of levels, 0 if empty
+    size_t height(void) const;
+
+
+    // insert
+    void insert(const T &value);
+
+
+    // erase; removes one value equal to value, returns false if there is none
+    bool erase(const T &value);
+
+
+    // search; returns a pointer to the first value equal to value, or nullptr if there is none
+    const T* search(const T &value) const;
+
+
+    // lower_bound; iterator to the first value that is not less than value, end() if there is none
+    iterator lower_bound(const T &value) const;
+
+
+    // upper_bound; iterator to the first value that is greater than value, end() if there is none
+    iterator upper_bound(const T &value) const;
+
+
+    // min
+    // throws std::length_error if tree is empty
+    const T& treeMin(void) const;
+
+
+    // max
+    // throws std::length_error if tree is empty
+    const T& treeMax(void) const;
+
+
+    // traversals; all three list the values in order (see above)
+    // throw std::length_error if tree is empty
+    DoublyLinkedList<T> getPreOrderTraversal(void) const;
+    DoublyLinkedList<T> getInOrderTraversal(void) const;
+    DoublyLinkedList<T> getPostOrderTraversal(void) const;
+
+
+    // visitInOrder; calls visit(value) on every value in order, leaf by leaf
+    template<class Visitor>
+    void visitInOrder(Visitor visit) const;
+
+
+    // iterators, in order
+    iterator begin(void) const;
+    iterator end(void) const;
+};
@@ -0,0 +1,738 @@
+/*
+BTree.tpp
+A file that contains the implementation of the BTree class methods in the BTree.hpp file.
+*/
+
+#pragma once
+
+#include "BTree.hpp"
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+// Increment operator.
+// Description: This function moves to the next value, in the same leaf or at the start of the next one.
+// Parameters: NONE.
+// Return value: this iterator.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+typename BTree<T,Comparator,NodeBytes,Allocator>::iterator& BTree<T,Comparator,NodeBytes,Allocator>::iterator::operator++(void){
+    index++;
+    if (index == leaf->count){
+        leaf = leaf->next;
+        index = 0;
+    }
+    return *this;
+}
+
+// Decrement operator.
+// Description: This function moves to the previous value, in the same leaf or at the end of the previous one;
+// end() moves to the maximum.
+// Parameters: NONE.
+// Return value: this iterator.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+typename BTree<T,Comparator,NodeBytes,Allocator>::iterator& BTree<T,Comparator,NodeBytes,Allocator>::iterator::operator--(void){
+    if (leaf != nullptr && index > 0){
+        index--;
+        return *this;
+    }
+    leaf = (leaf == nullptr) ? tree->tail : leaf->prev;
+    index = leaf->count - 1;
+    return *this;
+}
+
+// Create leaf function.
+// Description: This function allocates an empty leaf.
+// Parameters: NONE.
+// Return value: the new leaf, unlinked.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+typename BTree<T,Comparator,NodeBytes,Allocator>::Leaf* BTree<T,Comparator,NodeBytes,Allocator>::createLeaf(void){
+    Leaf *leaf = new (SlotAllocatorTraits::allocate(allocator, 1)) Leaf;
+    leaf->count = 0;
+    leaf->leaf = true;
+    leaf->prev = NULL;
+    leaf->next = NULL;
+    return leaf;
+}
+
+// Create inner function.
+// Description: This function allocates an inner node with no separators.
+// Parameters: NONE.
+// Return value: the new node, with no children.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+typename BTree<T,Comparator,NodeBytes,Allocator>::Inner* BTree<T,Comparator,NodeBytes,Allocator>::createInner(void){
+    Inner *inner = new (SlotAllocatorTraits::allocate(allocator, 1)) Inner;
+    inner->count = 0;
+    inner->leaf = false;
+    return inner;
+}
+
+// Destroy node function.
+// Description: This function destroys the values or separators of a node and gives its slot back.
+// Parameters: the node; its children are left alone.
+// Return value: NONE.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+void BTree<T,Comparator,NodeBytes,Allocator>::destroyNode(Node *node){
+    T *values = node->leaf ? static_cast<Leaf*>(node)->values() : static_cast<Inner*>(node)->keys();
+    for (size_t i = 0; i < node->count; i++){
+        values[i].~T();
+    }
+    SlotAllocatorTraits::deallocate(allocator, reinterpret_cast<Slot*>(node), 1);
+}
+
+// Delete subtree function.
+// Description: This function frees a subtree, children first. The recursion is as deep as the tree, O(log n).
+// Parameters: the root of the subtree.
+// Return value: NONE.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+void BTree<T,Comparator,NodeBytes,Allocator>::deleteSubTree(Node *node){
+    if (node == NULL){
+        return;
+    }
+    if (!node->leaf){
+        Inner *inner = static_cast<Inner*>(node);
+        for (size_t i = 0; i <= inner->count; i++){
+            deleteSubTree(inner->children[i]);
+        }
+    }
+    destroyNode(node);
+}
+
+// Copy subtree function.
+// Description: This function copies a subtree node by node, linking each copied leaf after the previous one.
+// Parameters: the root of the subtree; the last leaf copied so far, updated.
+// Return value: the root of the copy.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+typename BTree<T,Comparator,NodeBytes,Allocator>::Node* BTree<T,Comparator,NodeBytes,Allocator>::copySubTree(const Node *node, Leaf *&lastLeaf){
+    if (node->leaf){
+        const Leaf *source = static_cast<const Leaf*>(node);
+        Leaf *copy = createLeaf();
+        for (; copy->count < source->count; copy->count++){
+            new (copy->values() + copy->count) T(source->values()[copy->count]);
+        }
+        copy->prev = lastLeaf;
+        if (lastLeaf != NULL){
+            lastLeaf->next = copy;
+        }
+        lastLeaf = copy;
+        return copy;
+    }
+    const Inner *source = static_cast<const Inner*>(node);
+    Inner *copy = createInner();
+    copy->children[0] = copySubTree(source->children[0], lastLeaf);
+    for (; copy->count < source->count; copy->count++){
+        new (copy->keys() + copy->count) T(source->keys()[copy->count]);
+        copy->children[copy->count + 1] = copySubTree(source->children[copy->count + 1], lastLeaf);
+    }
+    return copy;
+}
+
+// Lower index function.
+// Description: This function binary searches the values of a node. The loop only narrows the range with
+// conditional moves, so it does not mispredict, and a node of a few cache lines is searched in a handful of steps.
+// Parameters: the values, in order; how many there are; the value to look for.
+// Return value: the first position whose value is not less than value, count if there is none.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+size_t BTree<T,Comparator,NodeBytes,Allocator>::lowerIndex(const T *values, size_t count, const T &value) const{
+    const T *base = values;
+    while (count > 0){
+        size_t half = count / 2;
+        // comparator(value, x) means value <= x, so x < value exactly when it does not hold
+        bool right = !comparator(value, base[half]);
+        base = right ? base + half + 1 : base;
+        count = right ? count - half - 1 : half;
+    }
+    return base - values;
+}
+
+// Upper index function.
+// Description: This function binary searches the values of a node, as lowerIndex does.
+// Parameters: the values, in order; how many there are; the value to look for.
+// Return value: the first position whose value is greater than value, count if there is none.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+size_t BTree<T,Comparator,NodeBytes,Allocator>::upperIndex(const T *values, size_t count, const T &value) const{
+    const T *base = values;
+    while (count > 0){
+        size_t half = count / 2;
+        bool right = comparator(base[half], value);
+        base = right ? base + half + 1 : base;
+        count = right ? count - half - 1 : half;
+    }
+    return base - values;
+}
+
+// Insert at function.
+// Description: This function inserts a value into an array of constructed values, shifting the later ones right
+// into the raw storage past the end.
+// Parameters: the values, their number, the position, the value.
+// Return value: NONE.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+void BTree<T,Comparator,NodeBytes,Allocator>::insertAt(T *values, size_t count, size_t position, const T &value){
+    if (position == count){
+        new (values + count) T(value);
+        return;
+    }
+    new (values + count) T(std::move(values[count - 1]));
+    move_backward(values + position, values + count - 1, values + count);
+    values[position] = value;
+}
+
+// Erase at function.
+// Description: This function removes a value from an array of constructed values, shifting the later ones left
+// and destroying the last one.
+// Parameters: the values, their number, the position.
+// Return value: NONE.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+void BTree<T,Comparator,NodeBytes,Allocator>::eraseAt(T *values, size_t count, size_t position){
+    std::move(values + position + 1, values + count, values + position);
+    values[count - 1].~T();
+}
+
+// Move to function.
+// Description: This function moves values into raw storage and destroys the originals.
+// Parameters: the values, their number, the raw storage.
+// Return value: NONE.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+void BTree<T,Comparator,NodeBytes,Allocator>::moveTo(T *from, size_t count, T *to){
+    for (size_t i = 0; i < count; i++){
+        new (to + i) T(std::move(from[i]));
+        from[i].~T();
+    }
+}
+
+// Default constructor.
+// Description: This function constructs an empty tree.
+// Parameters: the comparator, the allocator.
+// Return value: NONE.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+BTree<T,Comparator,NodeBytes,Allocator>::BTree(Comparator comparator, const Allocator &allocator) : allocator(allocator){
+    root = NULL;
+    head = NULL;
+    tail = NULL;
+    numValues = 0;
+    this->comparator = comparator;
+}
+
+// Copy constructor.
+// Description: This function constructs a tree that is a deep copy of another tree, node for node.
+// Parameters: a given tree.
+// Return value: NONE.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+BTree<T,Comparator,NodeBytes,Allocator>::BTree(const BTree<T, Comparator, NodeBytes, Allocator> &tree){
+    root = NULL;
+    head = NULL;
+    tail = NULL;
+    numValues = tree.numValues;
+    comparator = tree.comparator;
+    if (tree.root != NULL){
+        root = copySubTree(tree.root, tail);
+        for (head = tail; head->prev != NULL; head = head->prev){
+        }
+    }
+}
+
+// Move constructor.
+// Description: This function constructs a tree that takes over the nodes and the allocator of another tree,
+// leaving it empty with a new allocator, so that the two share no pool.
+// Parameters: a given tree.
+// Return value: NONE.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+BTree<T,Comparator,NodeBytes,Allocator>::BTree(BTree<T, Comparator, NodeBytes, Allocator> &&tree) noexcept : allocator(std::move(tree.allocator)){
+    tree.allocator = SlotAllocator();
+    root = tree.root;
+    head = tree.head;
+    tail = tree.tail;
+    numValues = tree.numValues;
+    comparator = tree.comparator;
+    tree.root = NULL;
+    tree.head = NULL;
+    tree.tail = NULL;
+    tree.numValues = 0;
+}
+
+// Assignment operator.
+// Description: This function replaces the contents of the tree with a deep copy of another tree.
+// Parameters: a given tree.
+// Return value: this tree.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+BTree<T, Comparator, NodeBytes, Allocator>& BTree<T,Comparator,NodeBytes,Allocator>::operator=(const BTree<T, Comparator, NodeBytes, Allocator> &tree){
+    if (this != &tree){
+        BTree<T, Comparator, NodeBytes, Allocator> copy(tree);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+// Move assignment operator.
+// Description: This function swaps the contents of two trees, allocators included; the old contents are destroyed
+// with tree.
+// Parameters: a given tree.
+// Return value: this tree.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+BTree<T, Comparator, NodeBytes, Allocator>& BTree<T,Comparator,NodeBytes,Allocator>::operator=(BTree<T, Comparator, NodeBytes, Allocator> &&tree) noexcept{
+    swap(root, tree.root);
+    swap(head, tree.head);
+    swap(tail, tree.tail);
+    swap(numValues, tree.numValues);
+    swap(comparator, tree.comparator);
+    swap(allocator, tree.allocator);
+    return *this;
+}
+
+// Destructor.
+// Description: This function frees every node.
+// Parameters: NONE.
+// Return value: NONE.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+BTree<T,Comparator,NodeBytes,Allocator>::~BTree(void){
+    deleteSubTree(root);
+}
+
+// Checks if is empty.
+// Description: This function checks if the tree is empty.
+// Parameters: NONE.
+// Return value: true if the tree is empty, and false otherwise.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+bool BTree<T,Comparator,NodeBytes,Allocator>::empty(void) const{
+    return numValues == 0;
+}
+
+// Get allocator.
+// Description: This function returns a copy of the allocator of the nodes.
+// Parameters: NONE.
+// Return value: the allocator, rebound to T.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+Allocator BTree<T,Comparator,NodeBytes,Allocator>::get_allocator(void) const{
+    return Allocator(allocator);
+}
+
+// Size.
+// Description: This function returns the number of values in the tree.
+// Parameters: NONE.
+// Return value: the number of values.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+size_t BTree<T,Comparator,NodeBytes,Allocator>::size(void) const{
+    return numValues;
+}
+
+// Height.
+// Description: This function counts the levels on the leftmost path; every leaf is at the same depth.
+// Parameters: NONE.
+// Return value: the number of levels, 0 if the tree is empty.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+size_t BTree<T,Comparator,NodeBytes,Allocator>::height(void) const{
+    size_t levels = 0;
+    for (const Node *node = root; node != NULL; node = node->leaf ? NULL : static_cast<const Inner*>(node)->children[0]){
+        levels++;
+    }
+    return levels;
+}
+
+// Split leaf function.
+// Description: This function moves the upper half of an overfull leaf to a new leaf linked after it.
+// Parameters: the leaf.
+// Return value: the new leaf, and its first value as the separator.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+typename BTree<T,Comparator,NodeBytes,Allocator>::Split BTree<T,Comparator,NodeBytes,Allocator>::splitLeaf(Leaf *leaf){
+    Leaf *right = createLeaf();
+    size_t keep = leaf->count / 2;
+    moveTo(leaf->values() + keep, leaf->count - keep, right->values());
+    right->count = leaf->count - keep;
+    leaf->count = keep;
+    right->prev = leaf;
+    right->next = leaf->next;
+    if (leaf->next != NULL){
+        leaf->next->prev = right;
+    }
+    else{
+        tail = right;
+    }
+    leaf->next = right;
+    Split split;
+    split.right = right;
+    split.separator.emplace(right->values()[0]);
+    return split;
+}
+
+// Split inner function.
+// Description: This function moves the upper half of an overfull inner node to a new node; the middle separator
+// goes up to the parent.
+// Parameters: the node.
+// Return value: the new node, and the middle separator.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+typename BTree<T,Comparator,NodeBytes,Allocator>::Split BTree<T,Comparator,NodeBytes,Allocator>::splitInner(Inner *inner){
+    Inner *right = createInner();
+    size_t middle = inner->count / 2;
+    Split split;
+    split.right = right;
+    split.separator.emplace(std::move(inner->keys()[middle]));
+    inner->keys()[middle].~T();
+    right->count = inner->count - middle - 1;
+    moveTo(inner->keys() + middle + 1, right->count, right->keys());
+    copy(inner->children + middle + 1, inner->children + inner->count + 1, right->children);
+    inner->count = middle;
+    return split;
+}
+
+// Insert into function.
+// Description: This function inserts a value into a subtree after the values equal to it, and splits the
+// subtree's root if it overflows. The recursion is as deep as the tree.
+// Parameters: the root of the subtree, the value.
+// Return value: the split, with right == NULL if there was none.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+typename BTree<T,Comparator,NodeBytes,Allocator>::Split BTree<T,Comparator,NodeBytes,Allocator>::insertInto(Node *node, const T &value){
+    if (node->leaf){
+        Leaf *leaf = static_cast<Leaf*>(node);
+        insertAt(leaf->values(), leaf->count, upperIndex(leaf->values(), leaf->count, value), value);
+        leaf->count++;
+        if (leaf->count > leafCapacity){
+            return splitLeaf(leaf);
+        }
+        return Split{NULL, nullopt};
+    }
+    Inner *inner = static_cast<Inner*>(node);
+    size_t i = upperIndex(inner->keys(), inner->count, value);
+    Split childSplit = insertInto(inner->children[i], value);
+    if (childSplit.right == NULL){
+        return Split{NULL, nullopt};
+    }
+    insertAt(inner->keys(), inner->count, i, *childSplit.separator);
+    copy_backward(inner->children + i + 1, inner->children + inner->count + 1, inner->children + inner->count + 2);
+    inner->children[i + 1] = childSplit.right;
+    inner->count++;
+    if (inner->count > innerCapacity){
+        return splitInner(inner);
+    }
+    return Split{NULL, nullopt};
+}
+
+// Insert function.
+// Description: This function inserts a value, growing the tree by a level at the root when the root splits.
+// Parameters: a value to be inserted.
+// Return value: NONE.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+void BTree<T,Comparator,NodeBytes,Allocator>::insert(const T &value){
+    if (root == NULL){
+        head = tail = createLeaf();
+        root = head;
+    }
+    Split split = insertInto(root, value);
+    numValues++;
+    if (split.right != NULL){
+        Inner *newRoot = createInner();
+        new (newRoot->keys()) T(std::move(*split.separator));
+        newRoot->children[0] = root;
+        newRoot->children[1] = split.right;
+        newRoot->count = 1;
+        root = newRoot;
+    }
+}
+
+// Fix underflow function.
+// Description: This function brings child i of parent back to half full after an erase, by taking a value from
+// a sibling that can spare one, or else by merging the child with a sibling.
+// Parameters: the parent, the index of the child.
+// Return value: NONE.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+void BTree<T,Comparator,NodeBytes,Allocator>::fixUnderflow(Inner *parent, size_t i){
+    Node *child = parent->children[i];
+    size_t minimum = child->leaf ? leafCapacity / 2 : innerCapacity / 2;
+    if (child->count >= minimum){
+        return;
+    }
+    Node *left = (i > 0) ? parent->children[i - 1] : NULL;
+    Node *right = (i < parent->count) ? parent->children[i + 1] : NULL;
+    T *separators = parent->keys();
+
+    if (child->leaf){
+        Leaf *leaf = static_cast<Leaf*>(child);
+        if (left != NULL && left->count > minimum){
+            Leaf *from = static_cast<Leaf*>(left);
+            insertAt(leaf->values(), leaf->count, 0, from->values()[from->count - 1]);
+            leaf->count++;
+            eraseAt(from->values(), from->count, from->count - 1);
+            from->count--;
+            separators[i - 1] = leaf->values()[0];
+        }
+        else if (right != NULL && right->count > minimum){
+            Leaf *from = static_cast<Leaf*>(right);
+            new (leaf->values() + leaf->count) T(std::move(from->values()[0]));
+            leaf->count++;
+            eraseAt(from->values(), from->count, 0);
+            from->count--;
+            separators[i] = from->values()[0];
+        }
+        else{
+            // merge the right one of the pair into the left one
+            size_t j = (left != NULL) ? i - 1 : i;
+            Leaf *into = static_cast<Leaf*>(parent->children[j]);
+            Leaf *from = static_cast<Leaf*>(parent->children[j + 1]);
+            moveTo(from->values(), from->count, into->values() + into->count);
+            into->count += from->count;
+            from->count = 0;
+            into->next = from->next;
+            if (from->next != NULL){
+                from->next->prev = into;
+            }
+            else{
+                tail = into;
+            }
+            destroyNode(from);
+            eraseAt(separators, parent->count, j);
+            copy(parent->children + j + 2, parent->children + parent->count + 1, parent->children + j + 1);
+            parent->count--;
+        }
+        return;
+    }
+
+    Inner *inner = static_cast<Inner*>(child);
+    if (left != NULL && left->count > minimum){
+        // rotate right through the parent's separator
+        Inner *from = static_cast<Inner*>(left);
+        insertAt(inner->keys(), inner->count, 0, separators[i - 1]);
+        copy_backward(inner->children, inner->children + inner->count + 1, inner->children + inner->count + 2);
+        inner->children[0] = from->children[from->count];
+        inner->count++;
+        separators[i - 1] = std::move(from->keys()[from->count - 1]);
+        eraseAt(from->keys(), from->count, from->count - 1);
+        from->count--;
+    }
+    else if (right != NULL && right->count > minimum){
+        // rotate left through the parent's separator
+        Inner *from = static_cast<Inner*>(right);
+        new (inner->keys() + inner->count) T(separators[i]);
+        inner->children[inner->count + 1] = from->children[0];
+        inner->count++;
+        separators[i] = std::move(from->keys()[0]);
+        eraseAt(from->keys(), from->count, 0);
+        copy(from->children + 1, from->children + from->count + 1, from->children);
+        from->count--;
+    }
+    else{
+        // merge: left separators, the parent's separator between them, right separators
+        size_t j = (left != NULL) ? i - 1 : i;
+        Inner *into = static_cast<Inner*>(parent->children[j]);
+        Inner *from = static_cast<Inner*>(parent->children[j + 1]);
+        new (into->keys() + into->count) T(std::move(separators[j]));
+        moveTo(from->keys(), from->count, into->keys() + into->count + 1);
+        copy(from->children, from->children + from->count + 1, into->children + into->count + 1);
+        into->count += from->count + 1;
+        from->count = 0;
+        destroyNode(from);
+        eraseAt(separators, parent->count, j);
+        copy(parent->children + j + 2, parent->children + parent->count + 1, parent->children + j + 1);
+        parent->count--;
+    }
+}
+
+// Erase from function.
+// Description: This function removes one value equal to the given one from a subtree, and repairs the child it
+// was removed from. Equal values may straddle a separator, so when the leftmost candidate child does not hold
+// the value, the next child is tried while its separator is still equal to the value.
+// Parameters: the root of the subtree, the value.
+// Return value: true if a value was removed.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+bool BTree<T,Comparator,NodeBytes,Allocator>::eraseFrom(Node *node, const T &value){
+    if (node->leaf){
+        Leaf *leaf = static_cast<Leaf*>(node);
+        size_t position = lowerIndex(leaf->values(), leaf->count, value);
+        // the value at position is not less than value, so it is equal if it is also <= value
+        if (position == leaf->count || !comparator(leaf->values()[position], value)){
+            return false;
+        }
+        eraseAt(leaf->values(), leaf->count, position);
+        leaf->count--;
+        return true;
+    }
+    Inner *inner = static_cast<Inner*>(node);
+    for (size_t i = lowerIndex(inner->keys(), inner->count, value); i <= inner->count; i++){
+        if (eraseFrom(inner->children[i], value)){
+            fixUnderflow(inner, i);
+            return true;
+        }
+        // separators are not less than value from i on; stop at the first one greater than value
+        if (i == inner->count || !comparator(inner->keys()[i], value)){
+            break;
+        }
+    }
+    return false;
+}
+
+// Erase function.
+// Description: This function removes one value equal to the given one, and shrinks the tree by a level when the
+// root is left with a single child.
+// Parameters: the value to remove.
+// Return value: true if a value was removed, false if there is none.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+bool BTree<T,Comparator,NodeBytes,Allocator>::erase(const T &value){
+    if (root == NULL || !eraseFrom(root, value)){
+        return false;
+    }
+    numValues--;
+    if (!root->leaf && root->count == 0){
+        Node *oldRoot = root;
+        root = static_cast<Inner*>(root)->children[0];
+        destroyNode(oldRoot);
+    }
+    else if (root->leaf && root->count == 0){
+        destroyNode(root);
+        root = NULL;
+        head = NULL;
+        tail = NULL;
+    }
+    return true;
+}
+
+// Lower bound position function.
+// Description: This function descends to the leftmost leaf that can hold the bound and searches it; if every
+// value there is smaller, the bound is the first value of the next leaf.
+// Parameters: a value; whether to skip the values equal to it.
+// Return value: the leaf and the position of the bound, or (NULL, 0) if there is none.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+pair<const typename BTree<T,Comparator,NodeBytes,Allocator>::Leaf*, size_t> BTree<T,Comparator,NodeBytes,Allocator>::lowerBoundPosition(const T &value, bool strict) const{
+    if (root == NULL){
+        return pair<const Leaf*, size_t>(NULL, 0);
+    }
+    const Node *node = root;
+    while (!node->leaf){
+        const Inner *inner = static_cast<const Inner*>(node);
+        size_t i = strict ? upperIndex(inner->keys(), inner->count, value) : lowerIndex(inner->keys(), inner->count, value);
+        node = inner->children[i];
+    }
+    const Leaf *leaf = static_cast<const Leaf*>(node);
+    size_t position = strict ? upperIndex(leaf->values(), leaf->count, value) : lowerIndex(leaf->values(), leaf->count, value);
+    if (position == leaf->count){
+        return pair<const Leaf*, size_t>(leaf->next, 0);
+    }
+    return pair<const Leaf*, size_t>(leaf, position);
+}
+
+// Search function.
+// Description: This function looks for the first value equal to the given one.
+// Parameters: a value to be searched.
+// Return value: a pointer to the value, or nullptr if the value is not found; it is valid until the tree changes.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+const T* BTree<T,Comparator,NodeBytes,Allocator>::search(const T &value) const{
+    pair<const Leaf*, size_t> bound = lowerBoundPosition(value, false);
+    // the bound is not less than value, so it is equal if it is also <= value
+    if (bound.first == NULL || !comparator(bound.first->values()[bound.second], value)){
+        return nullptr;
+    }
+    return &bound.first->values()[bound.second];
+}
+
+// Lower bound function.
+// Description: This function finds the first value that is not less than the given one.
+// Parameters: a value.
+// Return value: an iterator to the value, or end() if every value is less than the given one.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+typename BTree<T,Comparator,NodeBytes,Allocator>::iterator BTree<T,Comparator,NodeBytes,Allocator>::lower_bound(const T &value) const{
+    pair<const Leaf*, size_t> bound = lowerBoundPosition(value, false);
+    return iterator(bound.first, bound.second, this);
+}
+
+// Upper bound function.
+// Description: This function finds the first value that is greater than the given one.
+// Parameters: a value.
+// Return value: an iterator to the value, or end() if no value is greater than the given one.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+typename BTree<T,Comparator,NodeBytes,Allocator>::iterator BTree<T,Comparator,NodeBytes,Allocator>::upper_bound(const T &value) const{
+    pair<const Leaf*, size_t> bound = lowerBoundPosition(value, true);
+    return iterator(bound.first, bound.second, this);
+}
+
+// Min function.
+// Description: This function returns the smallest value, the first one of the first leaf.
+// Parameters: NONE.
+// Return value: the smallest value.
+// throws std::length_error if tree is empty.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+const T& BTree<T,Comparator,NodeBytes,Allocator>::treeMin(void) const{
+    if (numValues == 0){
+        throw length_error("Tree is empty!");
+    }
+    return head->values()[0];
+}
+
+// Max function.
+// Description: This function returns the largest value, the last one of the last leaf.
+// Parameters: NONE.
+// Return value: the largest value.
+// throws std::length_error if tree is empty.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+const T& BTree<T,Comparator,NodeBytes,Allocator>::treeMax(void) const{
+    if (numValues == 0){
+        throw length_error("Tree is empty!");
+    }
+    return tail->values()[tail->count - 1];
+}
+
+// Preorder traversal.
+// Description: This function returns the values in preorder, which in a B+ tree is their order (see BTree.hpp).
+// Parameters: NONE.
+// Return value: a DoublyLinkedList of the values.
+// throws std::length_error if tree is empty.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+DoublyLinkedList<T> BTree<T,Comparator,NodeBytes,Allocator>::getPreOrderTraversal(void) const{
+    return getInOrderTraversal();
+}
+
+// Inorder traversal.
+// Description: This function returns the values in order, walking the linked leaves.
+// Parameters: NONE.
+// Return value: a DoublyLinkedList of the values.
+// throws std::length_error if tree is empty.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+DoublyLinkedList<T> BTree<T,Comparator,NodeBytes,Allocator>::getInOrderTraversal(void) const{
+    if (numValues == 0){
+        throw length_error("Tree is empty!");
+    }
+    DoublyLinkedList<T> values;
+    visitInOrder([&values](const T &value){ values.push_back(value); });
+    return values;
+}
+
+// Postorder traversal.
+// Description: This function returns the values in postorder, which in a B+ tree is their order (see BTree.hpp).
+// Parameters: NONE.
+// Return value: a DoublyLinkedList of the values.
+// throws std::length_error if tree is empty.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+DoublyLinkedList<T> BTree<T,Comparator,NodeBytes,Allocator>::getPostOrderTraversal(void) const{
+    return getInOrderTraversal();
+}
+
+// Inorder visitor.
+// Description: This function calls visit on every value in order, leaf by leaf, without allocating.
+// Parameters: the visitor.
+// Return value: NONE.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+template<class Visitor>
+void BTree<T,Comparator,NodeBytes,Allocator>::visitInOrder(Visitor visit) const{
+    for (const Leaf *leaf = head; leaf != NULL; leaf = leaf->next){
+        const T *values = leaf->values();
+        for (size_t i = 0; i < leaf->count; i++){
+            visit(values[i]);
+        }
+    }
+}
+
+// Begin.
+// Description: This function returns an iterator to the smallest value.
+// Parameters: NONE.
+// Return value: an iterator to the first value, or end() if the tree is empty.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+typename BTree<T,Comparator,NodeBytes,Allocator>::iterator BTree<T,Comparator,NodeBytes,Allocator>::begin(void) const{
+    return iterator(head, 0, this);
+}
+
+// End.
+// Description: This function returns the past-the-end iterator.
+// Parameters: NONE.
+// Return value: an iterator that points at no value.
+template<class T, typename Comparator, size_t NodeBytes, typename Allocator>
+typename BTree<T,Comparator,NodeBytes,Allocator>::iterator BTree<T,Comparator,NodeBytes,Allocator>::end(void) const{
+    return iterator(NULL, 0, this);
+}
@@ -0,0 +1,135 @@
+/*
+File name: ConcurrentBST.hpp
+Creation Date: 10/16/2026
+Description: Header file for the ConcurrentBST<> templated class, a BST<> variant shared between threads
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+/*
+ConcurrentBST is an AVL tree that any number of threads may read while other threads insert and erase.
+
+- Writers (insert, erase) take a mutex, so they run one at a time.
+- Readers (search, contains, lower_bound) never lock. They descend optimistically and validate against a version
+  counter that writers make odd while they move existing nodes around (rotations, two-child erases); a reader
+  that overlapped such a change simply retries. Linking a new leaf or splicing out a node with at most one child
+  never misleads a reader, so those changes leave the version alone.
+- Values are never modified in place: a two-child erase links a fresh copy of the successor instead, so readers
+  can copy values without synchronization.
+- Unlinked nodes are not freed immediately. They are retired and freed in batches once every reader that could
+  still hold a pointer to them has finished (epoch-based reclamation with two reader counters per slot).
+
+Because nodes may be freed behind the caller's back, the read operations return copies of the values rather
+than node handles. The comparator follows the BST<> convention: comparator(a, b) is true if a <= b.
+*/
+template<class T, typename Comparator = std::less_equal<T> >
+class ConcurrentBST {
+
+    private:
+    struct Node {
+        // never changes once the node is reachable
+        const T value;
+        // read by everyone
+        std::atomic<Node*> left, right;
+        // only used by writers, under the lock
+        Node *parent;
+        int height;
+
+        Node(const T &value) : value(value), left(nullptr), right(nullptr), parent(nullptr), height(1) {}
+    };
+
+    // Readers announce themselves in one of these slots, picked per thread, so that readers on different cores
+    // do not fight over one counter. active[p] counts the readers that entered while the epoch had parity p.
+    struct alignas(64) ReaderSlot {
+        std::atomic<size_t> active[2];
+    };
+
+    static const size_t numReaderSlots = 64;
+    // number of retired nodes that triggers a reclamation
+    static const size_t retireBatch = 256;
+
+    std::atomic<Node*> root;
+    std::atomic<size_t> numNodes;
+    // odd while a writer is moving nodes
+    std::atomic<uint64_t> version;
+    std::atomic<size_t> epoch;
+    mutable ReaderSlot readers[numReaderSlots];
+    Comparator comparator;
+
+    // writer state, guarded by writeLock
+    std::mutex writeLock;
+    std::vector<Node*> retired;
+    bool restructuring;
+
+    // reader side
+    static size_t readerSlot(void);
+    size_t enterReader(size_t slot) const;
+    void exitReader(size_t slot, size_t parity) const;
+    template<class Result, class Read>
+    Result optimisticRead(Read read) const;
+    Node* lowerBoundNode(const T &value) const;
+
+    // writer side
+    void beginRestructure(void);
+    void endRestructure(void);
+    void replaceChild(Node *parent, Node *oldChild, Node *newChild);
+    static int heightOf(Node *node);
+    static void updateHeight(Node *node);
+    Node* rotateLeft(Node *node);
+    Node* rotateRight(Node *node);
+    void rebalance(Node *node);
+    void retire(Node *node);
+    void reclaim(void);
+    void deleteSubTree(Node *node);
+
+
+    public:
+    // default constructor
+    ConcurrentBST(Comparator comparator = Comparator());
+
+
+    // not copyable: readers may hold pointers into the tree
+    ConcurrentBST(const ConcurrentBST<T, Comparator> &tree) = delete;
+    ConcurrentBST<T, Comparator>& operator=(const ConcurrentBST<T, Comparator> &tree) = delete;
+
+
+    // destructor; no other thread may be using the tree
+    ~ConcurrentBST(void);
+
+
+    // checks if is empty
+    bool empty(void) const;
+
+
+    // size
+    size_t size(void) const;
+
+
+    // insert; blocks other writers, never readers
+    void insert(const T &value);
+
+
+    // erase; removes one value equal to value, blocks other writers, never readers
+    // returns false if there is no such value
+    bool erase(const T &value);
+
+
+    // search; a copy of a value equal to value, or an empty optional; never blocks
+    std::optional<T> search(const T &value) const;
+
+
+    // contains; never blocks
+    bool contains(const T &value) const;
+
+
+    // lower_bound; a copy of the smallest value that is not less than value, or an empty optional; never blocks
+    std::optional<T> lower_bound(const T &value) const;
+};
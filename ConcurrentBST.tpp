@@ -0,0 +1,457 @@
+/*
+ConcurrentBST.tpp
+A file that contains the implementation of the ConcurrentBST class methods in the ConcurrentBST.hpp file.
+*/
+
+#pragma once
+
+#include <thread>
+#include "ConcurrentBST.hpp"
+
+using namespace std;
+
+// Default constructor.
+// Description: This function constructs an empty tree.
+// Parameters: the comparator.
+// Return value: NONE.
+template<class T, typename Comparator>
+ConcurrentBST<T,Comparator>::ConcurrentBST(Comparator comparator) : root(nullptr), numNodes(0), version(0), epoch(0){
+    for (size_t i = 0; i < numReaderSlots; i++){
+        readers[i].active[0].store(0);
+        readers[i].active[1].store(0);
+    }
+    this->comparator = comparator;
+    restructuring = false;
+}
+
+// Destructor.
+// Description: This function frees every node, including the retired ones.
+// Parameters: NONE.
+// Return value: NONE.
+template<class T, typename Comparator>
+ConcurrentBST<T,Comparator>::~ConcurrentBST(void){
+    deleteSubTree(root.load());
+    for (size_t i = 0; i < retired.size(); i++){
+        delete retired[i];
+    }
+}
+
+// Delete subtree function.
+// Description: This function frees the subtree rooted at a given node.
+// Parameters: the root of the subtree.
+// Return value: NONE.
+template<class T, typename Comparator>
+void ConcurrentBST<T,Comparator>::deleteSubTree(Node *node){
+    if (node != nullptr){
+        deleteSubTree(node->left.load(memory_order_relaxed));
+        deleteSubTree(node->right.load(memory_order_relaxed));
+        delete node;
+    }
+}
+
+// Checks if is empty.
+// Description: This function checks if the tree is empty.
+// Parameters: NONE.
+// Return value: true if the tree is empty, and false otherwise.
+template<class T, typename Comparator>
+bool ConcurrentBST<T,Comparator>::empty(void) const{
+    return numNodes.load() == 0;
+}
+
+// Size.
+// Description: This function returns the number of values in the tree.
+// Parameters: NONE.
+// Return value: the number of values.
+template<class T, typename Comparator>
+size_t ConcurrentBST<T,Comparator>::size(void) const{
+    return numNodes.load();
+}
+
+// Reader slot function.
+// Description: This function picks the reader slot of the calling thread, spreading threads round-robin.
+// Parameters: NONE.
+// Return value: the index of the slot.
+template<class T, typename Comparator>
+size_t ConcurrentBST<T,Comparator>::readerSlot(void){
+    static atomic<size_t> nextSlot(0);
+    thread_local size_t slot = nextSlot.fetch_add(1) % numReaderSlots;
+    return slot;
+}
+
+// Enter reader function.
+// Description: This function registers a reader under the current epoch. If the epoch moves while registering,
+// the reader registers again, so a writer that has already checked the counters of the old epoch never misses it.
+// Parameters: the reader's slot.
+// Return value: the parity of the epoch the reader registered under.
+template<class T, typename Comparator>
+size_t ConcurrentBST<T,Comparator>::enterReader(size_t slot) const{
+    while (true){
+        size_t current = epoch.load();
+        readers[slot].active[current & 1].fetch_add(1);
+        if (epoch.load() == current){
+            return current & 1;
+        }
+        readers[slot].active[current & 1].fetch_sub(1);
+    }
+}
+
+// Exit reader function.
+// Description: This function unregisters a reader.
+// Parameters: the reader's slot, the parity it registered under.
+// Return value: NONE.
+template<class T, typename Comparator>
+void ConcurrentBST<T,Comparator>::exitReader(size_t slot, size_t parity) const{
+    readers[slot].active[parity].fetch_sub(1, memory_order_release);
+}
+
+// Optimistic read function.
+// Description: This function runs a read-only descent, retrying until no writer moved nodes while it ran.
+// Parameters: a callable doing the descent.
+// Return value: the result of the first descent that did not overlap a restructuring.
+template<class T, typename Comparator>
+template<class Result, class Read>
+Result ConcurrentBST<T,Comparator>::optimisticRead(Read read) const{
+    size_t slot = readerSlot();
+    size_t parity = enterReader(slot);
+    while (true){
+        uint64_t before = version.load(memory_order_acquire);
+        if (before & 1){
+            this_thread::yield();
+            continue;
+        }
+        Result result = read();
+        atomic_thread_fence(memory_order_acquire);
+        if (version.load(memory_order_relaxed) == before){
+            exitReader(slot, parity);
+            return result;
+        }
+    }
+}
+
+// Lower bound node function.
+// Description: This function descends from the root, remembering the last node where it turned left.
+// Parameters: a value.
+// Return value: the first node not less than value, or nullptr if there is none.
+template<class T, typename Comparator>
+typename ConcurrentBST<T,Comparator>::Node* ConcurrentBST<T,Comparator>::lowerBoundNode(const T &value) const{
+    Node *candidate = nullptr;
+    Node *current = root.load(memory_order_acquire);
+    while (current != nullptr){
+        if (comparator(value, current->value)){
+            candidate = current;
+            current = current->left.load(memory_order_acquire);
+        }
+        else{
+            current = current->right.load(memory_order_acquire);
+        }
+    }
+    return candidate;
+}
+
+// Search function.
+// Description: This function looks for a value equal to the given one without taking any lock.
+// Parameters: a value to be searched.
+// Return value: a copy of the value found, or an empty optional.
+template<class T, typename Comparator>
+optional<T> ConcurrentBST<T,Comparator>::search(const T &value) const{
+    return optimisticRead<optional<T> >([this, &value](){
+        Node *candidate = lowerBoundNode(value);
+        if (candidate != nullptr && comparator(candidate->value, value)){
+            return optional<T>(candidate->value);
+        }
+        return optional<T>();
+    });
+}
+
+// Contains function.
+// Description: This function checks for a value equal to the given one without taking any lock.
+// Parameters: a value to be searched.
+// Return value: true if the value is found, and false otherwise.
+template<class T, typename Comparator>
+bool ConcurrentBST<T,Comparator>::contains(const T &value) const{
+    return optimisticRead<bool>([this, &value](){
+        Node *candidate = lowerBoundNode(value);
+        return candidate != nullptr && comparator(candidate->value, value);
+    });
+}
+
+// Lower bound function.
+// Description: This function finds the smallest value not less than the given one without taking any lock.
+// Parameters: a value.
+// Return value: a copy of the lower bound, or an empty optional if every value is less than the given one.
+template<class T, typename Comparator>
+optional<T> ConcurrentBST<T,Comparator>::lower_bound(const T &value) const{
+    return optimisticRead<optional<T> >([this, &value](){
+        Node *candidate = lowerBoundNode(value);
+        return (candidate != nullptr) ? optional<T>(candidate->value) : optional<T>();
+    });
+}
+
+// Begin restructure function.
+// Description: This function makes the version odd before the first change that could mislead a reader.
+// Parameters: NONE.
+// Return value: NONE.
+template<class T, typename Comparator>
+void ConcurrentBST<T,Comparator>::beginRestructure(void){
+    if (!restructuring){
+        restructuring = true;
+        version.store(version.load(memory_order_relaxed) + 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+    }
+}
+
+// End restructure function.
+// Description: This function makes the version even again once the tree is consistent.
+// Parameters: NONE.
+// Return value: NONE.
+template<class T, typename Comparator>
+void ConcurrentBST<T,Comparator>::endRestructure(void){
+    if (restructuring){
+        restructuring = false;
+        version.store(version.load(memory_order_relaxed) + 1, memory_order_release);
+    }
+}
+
+// Replace child function.
+// Description: This function makes newChild take oldChild's place below parent, or at the root.
+// Parameters: the parent (nullptr for the root), the current child, its replacement.
+// Return value: NONE.
+template<class T, typename Comparator>
+void ConcurrentBST<T,Comparator>::replaceChild(Node *parent, Node *oldChild, Node *newChild){
+    if (parent == nullptr){
+        root.store(newChild, memory_order_release);
+    }
+    else if (parent->left.load(memory_order_relaxed) == oldChild){
+        parent->left.store(newChild, memory_order_release);
+    }
+    else{
+        parent->right.store(newChild, memory_order_release);
+    }
+}
+
+// Height function.
+// Description: This function returns the height of a subtree, 0 for an empty one.
+// Parameters: the root of the subtree.
+// Return value: the height.
+template<class T, typename Comparator>
+int ConcurrentBST<T,Comparator>::heightOf(Node *node){
+    return (node == nullptr) ? 0 : node->height;
+}
+
+// Update height function.
+// Description: This function recomputes the height of a node from its children.
+// Parameters: the node.
+// Return value: NONE.
+template<class T, typename Comparator>
+void ConcurrentBST<T,Comparator>::updateHeight(Node *node){
+    int leftHeight = heightOf(node->left.load(memory_order_relaxed));
+    int rightHeight = heightOf(node->right.load(memory_order_relaxed));
+    node->height = 1 + ((leftHeight > rightHeight) ? leftHeight : rightHeight);
+}
+
+// Rotate left function.
+// Description: This function makes the right child take the node's place. The links are changed in an order that
+// never creates a cycle, so a reader caught in the middle still terminates (and then retries).
+// Parameters: the node.
+// Return value: the new root of the subtree.
+template<class T, typename Comparator>
+typename ConcurrentBST<T,Comparator>::Node* ConcurrentBST<T,Comparator>::rotateLeft(Node *node){
+    beginRestructure();
+    Node *pivot = node->right.load(memory_order_relaxed);
+    Node *middle = pivot->left.load(memory_order_relaxed);
+    node->right.store(middle, memory_order_release);
+    if (middle != nullptr){
+        middle->parent = node;
+    }
+    pivot->left.store(node, memory_order_release);
+    replaceChild(node->parent, node, pivot);
+    pivot->parent = node->parent;
+    node->parent = pivot;
+    updateHeight(node);
+    updateHeight(pivot);
+    return pivot;
+}
+
+// Rotate right function.
+// Description: This function makes the left child take the node's place.
+// Parameters: the node.
+// Return value: the new root of the subtree.
+template<class T, typename Comparator>
+typename ConcurrentBST<T,Comparator>::Node* ConcurrentBST<T,Comparator>::rotateRight(Node *node){
+    beginRestructure();
+    Node *pivot = node->left.load(memory_order_relaxed);
+    Node *middle = pivot->right.load(memory_order_relaxed);
+    node->left.store(middle, memory_order_release);
+    if (middle != nullptr){
+        middle->parent = node;
+    }
+    pivot->right.store(node, memory_order_release);
+    replaceChild(node->parent, node, pivot);
+    pivot->parent = node->parent;
+    node->parent = pivot;
+    updateHeight(node);
+    updateHeight(pivot);
+    return pivot;
+}
+
+// Rebalance function.
+// Description: This function restores the AVL property from a node up to the root, stopping as soon as a
+// subtree's height is unchanged (see AVLBalance in BSTBalance.hpp).
+// Parameters: the lowest node whose subtree changed.
+// Return value: NONE.
+template<class T, typename Comparator>
+void ConcurrentBST<T,Comparator>::rebalance(Node *node){
+    while (node != nullptr){
+        int oldHeight = node->height;
+        Node *left = node->left.load(memory_order_relaxed);
+        Node *right = node->right.load(memory_order_relaxed);
+        if (heightOf(left) - heightOf(right) > 1){
+            if (heightOf(left->left.load(memory_order_relaxed)) < heightOf(left->right.load(memory_order_relaxed))){
+                rotateLeft(left);
+            }
+            node = rotateRight(node);
+        }
+        else if (heightOf(right) - heightOf(left) > 1){
+            if (heightOf(right->right.load(memory_order_relaxed)) < heightOf(right->left.load(memory_order_relaxed))){
+                rotateRight(right);
+            }
+            node = rotateLeft(node);
+        }
+        else{
+            updateHeight(node);
+        }
+        if (node->height == oldHeight){
+            return;
+        }
+        node = node->parent;
+    }
+}
+
+// Insert function.
+// Description: This function links a new leaf holding value and rebalances the tree.
+// Parameters: a value to be inserted.
+// Return value: NONE.
+template<class T, typename Comparator>
+void ConcurrentBST<T,Comparator>::insert(const T &value){
+    lock_guard<mutex> lock(writeLock);
+    Node *node = new Node(value);
+    Node *parent = nullptr;
+    Node *current = root.load(memory_order_relaxed);
+    bool goLeft = false;
+    while (current != nullptr){
+        parent = current;
+        goLeft = comparator(value, current->value);
+        current = (goLeft ? current->left : current->right).load(memory_order_relaxed);
+    }
+    node->parent = parent;
+    // Publishing a leaf cannot hide any other value from a reader, so the version stays even here.
+    if (parent == nullptr){
+        root.store(node, memory_order_release);
+    }
+    else{
+        (goLeft ? parent->left : parent->right).store(node, memory_order_release);
+    }
+    numNodes.fetch_add(1);
+    rebalance(parent);
+    endRestructure();
+}
+
+// Erase function.
+// Description: This function unlinks one node holding a value equal to the given one and retires it.
+// Parameters: a value to be erased.
+// Return value: true if a value was erased, false if there was none.
+template<class T, typename Comparator>
+bool ConcurrentBST<T,Comparator>::erase(const T &value){
+    lock_guard<mutex> lock(writeLock);
+    Node *node = lowerBoundNode(value);
+    if (node == nullptr || !comparator(node->value, value)){
+        return false;
+    }
+    Node *left = node->left.load(memory_order_relaxed);
+    Node *right = node->right.load(memory_order_relaxed);
+    Node *changed;
+    if (left == nullptr || right == nullptr){
+        // Readers already inside node keep following its unchanged child, so no restructuring is needed.
+        Node *child = (left != nullptr) ? left : right;
+        replaceChild(node->parent, node, child);
+        if (child != nullptr){
+            child->parent = node->parent;
+        }
+        changed = node->parent;
+    }
+    else{
+        // Link a copy of the successor in node's place, then splice the successor out of the right subtree.
+        Node *successor = right;
+        while (successor->left.load(memory_order_relaxed) != nullptr){
+            successor = successor->left.load(memory_order_relaxed);
+        }
+        Node *replacement = new Node(successor->value);
+        replacement->height = node->height;
+        replacement->parent = node->parent;
+        replacement->left.store(left, memory_order_relaxed);
+        Node *successorRight = successor->right.load(memory_order_relaxed);
+        if (successor == right){
+            replacement->right.store(successorRight, memory_order_relaxed);
+            changed = replacement;
+        }
+        else{
+            replacement->right.store(right, memory_order_relaxed);
+            changed = successor->parent;
+        }
+
+        beginRestructure();
+        replaceChild(node->parent, node, replacement);
+        left->parent = replacement;
+        if (successor == right){
+            if (successorRight != nullptr){
+                successorRight->parent = replacement;
+            }
+        }
+        else{
+            right->parent = replacement;
+            successor->parent->left.store(successorRight, memory_order_release);
+            if (successorRight != nullptr){
+                successorRight->parent = successor->parent;
+            }
+        }
+        retire(successor);
+    }
+    retire(node);
+    numNodes.fetch_sub(1);
+    rebalance(changed);
+    endRestructure();
+    reclaim();
+    return true;
+}
+
+// Retire function.
+// Description: This function queues an unlinked node until no reader can hold a pointer to it.
+// Parameters: the node.
+// Return value: NONE.
+template<class T, typename Comparator>
+void ConcurrentBST<T,Comparator>::retire(Node *node){
+    retired.push_back(node);
+}
+
+// Reclaim function.
+// Description: Once enough nodes are retired, this function advances the epoch, waits until every reader that
+// registered under the previous epoch has left, and frees the retired nodes. Readers that register from now on
+// can no longer reach them. Readers from two epochs ago were already waited for by the previous reclamation.
+// Parameters: NONE.
+// Return value: NONE.
+template<class T, typename Comparator>
+void ConcurrentBST<T,Comparator>::reclaim(void){
+    if (retired.size() < retireBatch){
+        return;
+    }
+    size_t previous = epoch.fetch_add(1) & 1;
+    for (size_t i = 0; i < numReaderSlots; i++){
+        while (readers[i].active[previous].load(memory_order_acquire) != 0){
+            this_thread::yield();
+        }
+    }
+    for (size_t i = 0; i < retired.size(); i++){
+        delete retired[i];
+    }
+    retired.clear();
+}
@@ -19,9 +19,19 @@ ABOUT THIS FILE:
 // Modern way of doing include guards; nothing wrong with the old way
 #pragma once
 #include <iostream>
-
-
-template<class T>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <iterator>
+#include <cstddef>
+#include "PoolAllocator.hpp"
+#include "PoolAllocator.tpp"
+
+
+// The optional second template parameter is the allocator used for the nodes. The default, PoolAllocator<T>,
+// gives each list its own pool (see PoolAllocator.hpp), so nodes are carved from contiguous blocks and a list
+// of trivially destructible values is freed in one pass over the blocks.
+template<class T, class Allocator = PoolAllocator<T> >
 class DoublyLinkedList{
 
     private:
@@ -53,6 +63,19 @@ class DoublyLinkedList{
         Exceptions: None
         */
         Node(const T &item) : value(item), prev(nullptr), next(nullptr) {}
+
+
+        /*
+        Description:
+            - In-place constructor for DoublyLinkedList<T>::Node; builds the value from `args`
+        Parameters:
+            - std::in_place_t: tag that selects this constructor
+            - Args&&... args: the arguments forwarded to the constructor of T
+        Return: None
+        Exceptions: None
+        */
+        template<class... Args>
+        Node(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...), prev(nullptr), next(nullptr) {}
         
         
         /*
@@ -71,21 +94,122 @@ class DoublyLinkedList{
     Node* tail;
     // Member keeping track of the number of elements in the list
     size_t numElements;
+    // The node last reached by index, and its index, or nullptr: a walk to a nearby index starts here, so
+    // visiting the indices in order costs one step each
+    Node* cursor;
+    size_t cursorIndex;
+
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator;
+    typedef std::allocator_traits<NodeAllocator> NodeAllocatorTraits;
+    // Allocator for the nodes
+    NodeAllocator allocator;
+
+    /*
+    Description:
+        - Allocates a node from the allocator and constructs its value from `args`
+    Parameters:
+        - Args&&... args: the arguments forwarded to the constructor of T
+    Return: a pointer to a new node with null links
+    Exceptions: None
+    */
+    template<class... Args>
+    Node* createNode(Args&&... args);
+
+    /*
+    Description:
+        - Destroys a node created by createNode and returns its memory to the allocator
+    Parameters:
+        - Node *node: the node to destroy
+    Return: None
+    Exceptions: None
+    */
+    void destroyNode(Node *node);
+
+    /*
+    Description:
+        - Links a node with null links in at position `index`, which must be at most the size of the list
+    Parameters:
+        - Node *node: the node to link
+        - size_t index: the index the node takes
+    Return: None
+    Exceptions: None
+    */
+    void linkNodeAt(Node *node, size_t index);
+
+    /*
+    Description:
+        - Destroys every node of the list and leaves it empty
+    Parameters: None
+    Return: None
+    Exceptions: None
+    */
+    void destroyNodes(void);
 
     /*
     Description:
-        - Computes the pointer to the node at the specified index
+        - Prepares the list to take over the nodes of `list`; pooled allocators merge their pools so that either
+          list can free the other's nodes
+    Parameters:
+        - DoublyLinkedList<T, Allocator> &list: the list whose nodes will be linked into this one
+    Return:
+        - `true` if the nodes can be relinked, `false` if they must be moved element by element
+    Exceptions: None
+    */
+    bool canAdoptNodes(DoublyLinkedList<T, Allocator> &list);
+
+    /*
+    Description:
+        - Computes the pointer to the node at the specified index, walking from whichever of the head, the tail and
+          the cursor is nearest, and moves the cursor there
     Parameters: 
         - size_t index: the specified index as (unsigned)
     Return: a pointer of type Node
     Exceptions:
-        - std::out_of_range if the index is greater than the number of elements in the list
+        - std::out_of_range if the index is not less than the number of elements in the list
     */
     Node* getPointer(size_t index); // this is private, so keep pointer
 
 
     public:
 
+    /*
+    Description:
+        - Bidirectional iterator over the elements, from head to tail; `Value` is T for iterator and const T for const_iterator
+    */
+    template<class Value>
+    class BasicIterator {
+        private:
+        Node *node;
+        const DoublyLinkedList<T, Allocator> *list;
+
+        public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Value* pointer;
+        typedef Value& reference;
+
+        BasicIterator(void) : node(nullptr), list(nullptr) {}
+        BasicIterator(Node *node, const DoublyLinkedList<T, Allocator> *list) : node(node), list(list) {}
+        // an iterator converts to a const_iterator
+        operator BasicIterator<const T>(void) const { return BasicIterator<const T>(node, list); }
+
+        reference operator*(void) const { return node->value; }
+        pointer operator->(void) const { return &node->value; }
+
+        BasicIterator& operator++(void) { node = node->next; return *this; }
+        BasicIterator operator++(int) { BasicIterator old = *this; node = node->next; return old; }
+        // decrementing end() yields the tail
+        BasicIterator& operator--(void) { node = (node == nullptr) ? list->tail : node->prev; return *this; }
+        BasicIterator operator--(int) { BasicIterator old = *this; --(*this); return old; }
+
+        bool operator==(const BasicIterator &rhs) const { return node == rhs.node; }
+        bool operator!=(const BasicIterator &rhs) const { return node != rhs.node; }
+    };
+    typedef BasicIterator<T> iterator;
+    typedef BasicIterator<const T> const_iterator;
+
+
     /*
     Description:
         - Default Constructor for DoublyLinkedList<T>
@@ -93,7 +217,18 @@ class DoublyLinkedList{
     Return: None
     Exceptions: None
     */
-    DoublyLinkedList<T>(void);
+    DoublyLinkedList(void);
+
+
+    /*
+    Description:
+        - Constructor for DoublyLinkedList<T> using the given allocator for its nodes
+    Parameters:
+        - const Allocator &allocator: the allocator, e.g. a copy of another list's allocator to share its pool
+    Return: None
+    Exceptions: None
+    */
+    explicit DoublyLinkedList(const Allocator &allocator);
 
 
     /*
@@ -105,7 +240,20 @@ class DoublyLinkedList{
     Return: None
     Exceptions: None
     */
-    DoublyLinkedList<T>(const DoublyLinkedList<T>& list);
+    DoublyLinkedList(const DoublyLinkedList<T, Allocator>& list);
+
+
+    /*
+    Description:
+        - Move Constructor for DoublyLinkedList<T>; takes over the nodes of `list` and its allocator without copying
+          them. `list` gets a new allocator (with PoolAllocator, a pool of its own), so it can be reused on another
+          thread, and this list's pool stays unshared.
+    Parameters: 
+        - DoublyLinkedList<T> &&list: Doubly-linked list to move from; it is left empty and still usable
+    Return: None
+    Exceptions: None
+    */
+    DoublyLinkedList(DoublyLinkedList<T, Allocator>&& list) noexcept;
 
 
     /*
@@ -118,8 +266,9 @@ class DoublyLinkedList{
     Exceptions: None
     Note: 
         - This may defer from what you've seen in CS 173; here, rhs is not a const reference, which allows the compiler to insert a call to the copy constructor and optimize in ways we couldn't. 
+        - The nodes of `rhs` are swapped in, so assigning from an rvalue uses the move constructor and copies nothing.
     */
-    DoublyLinkedList<T>& operator=(DoublyLinkedList<T> rhs);
+    DoublyLinkedList<T, Allocator>& operator=(DoublyLinkedList<T, Allocator> rhs);
 
 
     /*
@@ -129,7 +278,7 @@ class DoublyLinkedList{
     Return: None
     Exceptions: None
     */
-    ~DoublyLinkedList<T>(void);
+    ~DoublyLinkedList(void);
 
 
     /*
@@ -145,6 +294,19 @@ class DoublyLinkedList{
     void insert(const T &item, size_t index);
 
 
+    /*
+    Description:
+        - Inserts `item` at position `index` in the list, moving it into the node
+    Parameters:
+        - T &&item: the item to be inserted
+        - size_t index: the index at which to place `item`
+    Return: None
+    Exceptions:
+        - std::out_of_range if `index` exceeds the size of the list
+    */
+    void insert(T &&item, size_t index);
+
+
     /*
     Description:
         - Erases the node at position `index`, freeing the memory allocated to the node and updating the surrounding pointers to keep integrity of the list
@@ -180,6 +342,30 @@ class DoublyLinkedList{
     void push_front(const T &item);
 
 
+    /*
+    Description:
+        - Inserts item at the front of the list, moving it into the node
+    Parameters:
+        - T &&item: the value to be inserted
+    Return: None
+    Exceptions: None
+    */
+    void push_front(T &&item);
+
+
+    /*
+    Description:
+        - Constructs an item at the front of the list from `args`
+    Parameters:
+        - Args&&... args: the arguments forwarded to the constructor of T
+    Return:
+        - A reference to the new item
+    Exceptions: None
+    */
+    template<class... Args>
+    T& emplace_front(Args&&... args);
+
+
     /*
     Description:
         - Inserts item at the end of the list
@@ -191,6 +377,30 @@ class DoublyLinkedList{
     void push_back(const T &item);
 
 
+    /*
+    Description:
+        - Inserts item at the end of the list, moving it into the node
+    Parameters:
+        - T &&item: the value to be inserted
+    Return: None
+    Exceptions: None
+    */
+    void push_back(T &&item);
+
+
+    /*
+    Description:
+        - Constructs an item at the end of the list from `args`
+    Parameters:
+        - Args&&... args: the arguments forwarded to the constructor of T
+    Return:
+        - A reference to the new item
+    Exceptions: None
+    */
+    template<class... Args>
+    T& emplace_back(Args&&... args);
+
+
     /*
     Description:
         - Erases the node at the front of the list and returns its value
@@ -250,6 +460,17 @@ class DoublyLinkedList{
     bool empty(void) const;
 
 
+    /*
+    Description:
+        - Returns a copy of the allocator the list uses for its nodes
+    Parameters: None
+    Return:
+        - The allocator, rebound to T
+    Exceptions: None
+    */
+    Allocator get_allocator(void) const;
+
+
     /*
     Description:
         - Concatenates the current list and `list` by constructing a new list that starts with the elements of the current list (in order) followed by the elements of `list` (in order)
@@ -259,7 +480,43 @@ class DoublyLinkedList{
         - The newly constructed list created from the concatenation
     Exceptions: None
     */
-    DoublyLinkedList<T> concatenate(const DoublyLinkedList<T> &list) const;
+    DoublyLinkedList<T, Allocator> concatenate(const DoublyLinkedList<T, Allocator> &list) const &;
+
+
+    /*
+    Description:
+        - Concatenates the current list and `list` when both are about to be thrown away, by linking the nodes of `list` after the current list's nodes
+    Parameters:
+        - DoublyLinkedList<T> &&list: the list to concatenate the current list with; it is left empty
+    Return:
+        - The concatenation, built from the nodes of both lists without copying
+    Exceptions: None
+    */
+    DoublyLinkedList<T, Allocator> concatenate(DoublyLinkedList<T, Allocator> &&list) &&;
+
+
+    /*
+    Description:
+        - Moves all the nodes of `list` into the current list, before position `index`. No element is copied; linking the nodes takes O(1) once the position is found (immediately for the front and the back).
+    Parameters:
+        - size_t index: the position at which the first element of `list` will be
+        - DoublyLinkedList<T> &&list: the list to splice in; it is left empty
+    Return: None
+    Exceptions:
+        - std::out_of_range if `index` exceeds the size of the list
+    */
+    void splice(size_t index, DoublyLinkedList<T, Allocator> &&list);
+
+
+    /*
+    Description:
+        - Moves all the nodes of `list` to the end of the current list in O(1)
+    Parameters:
+        - DoublyLinkedList<T> &&list: the list to append; it is left empty
+    Return: None
+    Exceptions: None
+    */
+    void append(DoublyLinkedList<T, Allocator> &&list);
 
 
     /*
@@ -272,7 +529,7 @@ class DoublyLinkedList{
         - `true` if the two lists are equal, `false` otherwise
     Exceptions: None
     */
-    bool operator==(const DoublyLinkedList<T> &rhs) const;
+    bool operator==(const DoublyLinkedList<T, Allocator> &rhs) const;
 
 
     /*
@@ -285,7 +542,21 @@ class DoublyLinkedList{
         - `false` if the two lists are equal, `true` otherwise
     Exceptions: None
     */
-    bool operator!=(const DoublyLinkedList<T> &rhs) const;
+    bool operator!=(const DoublyLinkedList<T, Allocator> &rhs) const;
+
+
+    /*
+    Description:
+        - Iterators to the first element and past the last element
+    Parameters: None
+    Returns:
+        - An iterator to the head, or end() if the list is empty; the past-the-end iterator
+    Exceptions: None
+    */
+    iterator begin(void);
+    iterator end(void);
+    const_iterator begin(void) const;
+    const_iterator end(void) const;
 };
 
 
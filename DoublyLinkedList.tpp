@@ -4,6 +4,8 @@ A file that contains the implementation of the List class methods in the DoublyL
 Written by: Khoi V, Duc T.
 */
 
+#pragma once
+
 #include <iostream>
 #include <cstdlib>
 #include <cassert>
@@ -15,54 +17,61 @@ using namespace std;
 // Default constructor.
 // Parameter: NONE.
 // Return value: NONE.
-template <class T>
-DoublyLinkedList<T>::DoublyLinkedList(void) {
+template <class T, class Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(void) {
     head = nullptr;
     tail = nullptr;
     numElements = 0;
+    cursor = nullptr;
+    cursorIndex = 0;
 }
 
-// Copy constructor. This copies the data from a doubly linked list to another one.
-// Parameter: A given doubly linked list.
+// Allocator constructor.
+// Parameter: The allocator to take the nodes from.
 // Return value: NONE.
-template <class T>
-DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList<T>& list) {
+template <class T, class Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const Allocator &allocator) : allocator(allocator) {
     head = nullptr;
     tail = nullptr;
     numElements = 0;
-    // Use a pointer to trace the nodes of the list we want to copy.
-    Node* current = list.head;
-    Node* lastNodeGenerated = nullptr;
-
-    while (current != nullptr) {
-        Node *newNode = new Node;
-        newNode->value = current->value;
-        newNode->prev = lastNodeGenerated;
-        newNode->next = nullptr;
+    cursor = nullptr;
+    cursorIndex = 0;
+}
 
-        if (lastNodeGenerated != nullptr) {
-            lastNodeGenerated->next = newNode;
-        } else {
-            head = newNode;  // Set head for the first node
-        }
-        lastNodeGenerated = newNode;
-        current = current->next;
-        numElements++;
+// Create node. This allocates a node from the allocator and constructs its value from the given arguments.
+// Parameter: The arguments for the constructor of the value.
+// Return value: A pointer to the new node, with null links.
+template <class T, class Allocator>
+template <class... Args>
+typename DoublyLinkedList<T, Allocator>::Node* DoublyLinkedList<T, Allocator>::createNode(Args&&... args) {
+    Node *node = NodeAllocatorTraits::allocate(allocator, 1);
+    try {
+        NodeAllocatorTraits::construct(allocator, node, in_place, std::forward<Args>(args)...);
+    } catch (...) {
+        NodeAllocatorTraits::deallocate(allocator, node, 1);
+        throw;
     }
-    
-    // Set tail to the last node generated.
-    tail = lastNodeGenerated;
+    return node;
 }
 
-// Destructor.
+// Destroy node. This destroys a node and gives its memory back to the allocator.
+// Parameter: The node to destroy.
+// Return value: NONE.
+template <class T, class Allocator>
+void DoublyLinkedList<T, Allocator>::destroyNode(Node *node) {
+    NodeAllocatorTraits::destroy(allocator, node);
+    NodeAllocatorTraits::deallocate(allocator, node, 1);
+}
+
+// Destroy nodes. This destroys every node and leaves the list empty.
 // Parameter: None.
 // Return value: None.
-template <class T>
-DoublyLinkedList<T>::~DoublyLinkedList(void) {
+template <class T, class Allocator>
+void DoublyLinkedList<T, Allocator>::destroyNodes(void) {
     Node* current = head;
     while (current != nullptr) {
         Node* temp = current->next;
-        delete current;
+        destroyNode(current);
         current = temp;
     }
     // Set head and tail to nullptr to avoid dangling pointers.
@@ -70,66 +79,166 @@ DoublyLinkedList<T>::~DoublyLinkedList(void) {
     tail = nullptr;
     // Set the number of elements to 0.
     numElements = 0;
+    cursor = nullptr;
 }
 
-// Assignment Operator. This assigns to a list the same list as the list being assigned.
-// Parameter: The list to be assigned.
-// Return value: A new list which is exactly the same as the list being assigned.
-template <class T>
-DoublyLinkedList<T>& DoublyLinkedList<T>::operator=(DoublyLinkedList<T> rhs) {
-    if (this == &rhs) {
-        return *this;  // Self-assignment check
-    }
-
-    // Destroy the current list
-    Node* current = head;
-    while (current != nullptr) {
-        Node* temp = current->next;
-        delete current;
-        current = temp;
-    }
+// Copy constructor. This copies the data from a doubly linked list to another one.
+// Parameter: A given doubly linked list.
+// Return value: NONE.
+template <class T, class Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const DoublyLinkedList<T, Allocator>& list) {
     head = nullptr;
     tail = nullptr;
     numElements = 0;
-
-    // Copy the new list
-    Node* current2 = rhs.head;
+    cursor = nullptr;
+    cursorIndex = 0;
+    // Use a pointer to trace the nodes of the list we want to copy.
+    Node* current = list.head;
     Node* lastNodeGenerated = nullptr;
 
-    while (current2 != nullptr) {
-        Node* newNode = new Node;
-        newNode->value = current2->value;
+    while (current != nullptr) {
+        Node *newNode = createNode(current->value);
         newNode->prev = lastNodeGenerated;
         newNode->next = nullptr;
 
-        if (lastNodeGenerated == nullptr) {
-            head = newNode;  // Set head for the new list
-        } else {
+        if (lastNodeGenerated != nullptr) {
             lastNodeGenerated->next = newNode;
+        } else {
+            head = newNode;  // Set head for the first node
         }
-
         lastNodeGenerated = newNode;
-        current2 = current2->next;
+        current = current->next;
         numElements++;
     }
+    
+    // Set tail to the last node generated.
     tail = lastNodeGenerated;
+}
+
+// Move constructor. This takes over the nodes and the allocator of another list, which is left empty with a new
+// allocator, so that the two lists share no pool.
+// Parameter: A given doubly linked list.
+// Return value: NONE.
+template <class T, class Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(DoublyLinkedList<T, Allocator>&& list) noexcept : allocator(std::move(list.allocator)) {
+    list.allocator = NodeAllocator();
+    head = list.head;
+    tail = list.tail;
+    numElements = list.numElements;
+    cursor = list.cursor;
+    cursorIndex = list.cursorIndex;
+    list.head = nullptr;
+    list.tail = nullptr;
+    list.numElements = 0;
+    list.cursor = nullptr;
+}
+
+// Can adopt nodes. This checks whether the nodes of another list can be linked into this one and freed by our allocator.
+// Parameter: The list whose nodes will be taken over.
+// Return value: True if the nodes can be relinked, false if the elements have to be moved one by one.
+template <class T, class Allocator>
+bool DoublyLinkedList<T, Allocator>::canAdoptNodes(DoublyLinkedList<T, Allocator> &list) {
+    if (allocator == list.allocator) {
+        return true;
+    }
+    if constexpr (IsPoolAllocator<NodeAllocator>::value) {
+        allocator.adopt(list.allocator);
+        return true;
+    }
+    return false;
+}
+
+// Get pointer. This finds the node at a given index, starting from whichever of the head, the tail and the
+// cursor is closest to it, and leaves the cursor on that node.
+// Parameter: The index position to find.
+// Return value: A pointer to the node at the given index.
+// Throws: std::out_of_range if the index is out of range.
+template <class T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::Node* DoublyLinkedList<T, Allocator>::getPointer(size_t index) {
+    if (index >= numElements) {
+        throw out_of_range("Index out of range.");
+    }
+    Node *current = head;
+    size_t position = 0;
+    if (numElements - 1 - index < index) {
+        current = tail;
+        position = numElements - 1;
+    }
+    if (cursor != nullptr) {
+        size_t fromCursor = (index > cursorIndex) ? index - cursorIndex : cursorIndex - index;
+        size_t fromEnd = (index > position) ? index - position : position - index;
+        if (fromCursor < fromEnd) {
+            current = cursor;
+            position = cursorIndex;
+        }
+    }
+    for (; position < index; position++) {
+        current = current->next;
+    }
+    for (; position > index; position--) {
+        current = current->prev;
+    }
+    cursor = current;
+    cursorIndex = index;
+    return current;
+}
+
+// Destructor.
+// Parameter: None.
+// Return value: None.
+template <class T, class Allocator>
+DoublyLinkedList<T, Allocator>::~DoublyLinkedList(void) {
+    if constexpr (IsPoolAllocator<Allocator>::value && is_trivially_destructible<T>::value) {
+        // Nothing to run per node: the blocks are released with the pool if no one else uses it.
+        if (allocator.uniquePool()) {
+            return;
+        }
+    }
+    destroyNodes();
+}
+
+// Assignment Operator. This assigns to a list the same list as the list being assigned.
+// Parameter: The list to be assigned, already copied (or moved) into rhs by the caller.
+// Return value: A new list which is exactly the same as the list being assigned.
+template <class T, class Allocator>
+DoublyLinkedList<T, Allocator>& DoublyLinkedList<T, Allocator>::operator=(DoublyLinkedList<T, Allocator> rhs) {
+    // rhs is our own copy: swap its nodes in, and the old nodes are destroyed with rhs.
+    std::swap(head, rhs.head);
+    std::swap(tail, rhs.tail);
+    std::swap(numElements, rhs.numElements);
+    std::swap(cursor, rhs.cursor);
+    std::swap(cursorIndex, rhs.cursorIndex);
+    std::swap(allocator, rhs.allocator);
     return *this;  // Allow chain assignments
 }
 
 // Insert operator. This inserts a node with a given value at a given index position in the doubly linked list.
 // Parameters: Value and the index position to be inserted.
 // Return value: Throws std::out_of_range if the index is out of range.
-template <class T>
-void DoublyLinkedList<T>::insert(const T &item, size_t index) {
+template <class T, class Allocator>
+void DoublyLinkedList<T, Allocator>::insert(const T &item, size_t index) {
     if (index > numElements) {
         throw out_of_range("Index out of range.");
     }
+    linkNodeAt(createNode(item), index);
+}
 
-    Node* temp = new Node;
-    temp->value = item;
-    temp->prev = nullptr;
-    temp->next = nullptr;
+// Insert operator. This moves a value into a new node at a given index position in the doubly linked list.
+// Parameters: Value and the index position to be inserted.
+// Return value: Throws std::out_of_range if the index is out of range.
+template <class T, class Allocator>
+void DoublyLinkedList<T, Allocator>::insert(T &&item, size_t index) {
+    if (index > numElements) {
+        throw out_of_range("Index out of range.");
+    }
+    linkNodeAt(createNode(std::move(item)), index);
+}
 
+// Link node operator. This links a new node in at a given index position, which has already been checked.
+// Parameters: The node, with null links, and the index position it takes.
+// Return value: None.
+template <class T, class Allocator>
+void DoublyLinkedList<T, Allocator>::linkNodeAt(Node *temp, size_t index) {
     if (index == 0) { // Inserting at the beginning.
         temp->next = head;
         if (head != nullptr) {
@@ -140,14 +249,7 @@ void DoublyLinkedList<T>::insert(const T &item, size_t index) {
             tail = temp;
         }
     } else {
-        Node* current = head;
-        for (size_t i = 0; i < index; i++) {
-            if (current == nullptr) {
-                // This should never happen because of our index check above.
-                throw runtime_error("Unexpected null pointer encountered.");
-            }
-            current = current->next;
-        }
+        Node* current = (index < numElements) ? getPointer(index) : nullptr;
         // Insert temp before 'current'
         if (current != nullptr) {
             temp->next = current;
@@ -166,18 +268,23 @@ void DoublyLinkedList<T>::insert(const T &item, size_t index) {
         }
     }
     numElements++;
+    // The new node takes the index, so a run of inserts at consecutive indices walks one step each.
+    cursor = temp;
+    cursorIndex = index;
 }
 
 // Erase operator. This deletes a node at a given index position in the doubly linked list.
 // Parameters: Index position of the node to be deleted.
 // Return value: Throws std::out_of_range if the index is out of range.
-template <class T>
-void DoublyLinkedList<T>::erase(size_t index) {
+template <class T, class Allocator>
+void DoublyLinkedList<T, Allocator>::erase(size_t index) {
     if (index >= numElements) {
         throw out_of_range("Index out of range.");
     }
 
     Node* toDelete = head;
+    // The node after the deleted one takes its index; the cursor moves there, and stays valid.
+    Node* follower = nullptr;
 
     // Case 1: Deleting the head node
     if (index == 0) {
@@ -187,7 +294,8 @@ void DoublyLinkedList<T>::erase(size_t index) {
         } else {
             tail = nullptr; // List becomes empty.
         }
-        delete toDelete;
+        destroyNode(toDelete);
+        follower = head;
     }
     // Case 2: Deleting the tail node
     else if (index == numElements - 1) {
@@ -198,27 +306,28 @@ void DoublyLinkedList<T>::erase(size_t index) {
         } else {
             head = nullptr; // List becomes empty.
         }
-        delete toDelete;
+        destroyNode(toDelete);
     }
     // Case 3: Deleting a middle node
     else {
-        for (size_t i = 0; i < index; i++) {
-            toDelete = toDelete->next;
-        }
+        toDelete = getPointer(index);
         Node* prevToDelete = toDelete->prev;
         Node* nextToDelete = toDelete->next;
         prevToDelete->next = nextToDelete;
         nextToDelete->prev = prevToDelete;
-        delete toDelete;
+        destroyNode(toDelete);
+        follower = nextToDelete;
     }
     numElements--;
+    cursor = follower;
+    cursorIndex = index;
 }
 
 // Search operator. This returns the index value of the first node with value equal to 'item'.
 // Parameter: value 'item' to be found in the list.
 // Return value: The smallest index of a node containing 'item'. If no such node exists, returns numElements.
-template <class T>
-size_t DoublyLinkedList<T>::search(const T &item) const {
+template <class T, class Allocator>
+size_t DoublyLinkedList<T, Allocator>::search(const T &item) const {
     Node* current = head;
     size_t counter = 0;
     while (current != nullptr) {  // Check if current is not null
@@ -234,10 +343,26 @@ size_t DoublyLinkedList<T>::search(const T &item) const {
 // Push front operator. This adds a new node with the 'item' value at the start of the doubly linked list.
 // Parameter: value 'item' to be added.
 // Return value: None.
-template <class T>
-void DoublyLinkedList<T>::push_front(const T &item) {
-    Node* temp = new Node;
-    temp->value = item;
+template <class T, class Allocator>
+void DoublyLinkedList<T, Allocator>::push_front(const T &item) {
+    emplace_front(item);
+}
+
+// Push front operator. This moves 'item' into a new node at the start of the doubly linked list.
+// Parameter: value 'item' to be added.
+// Return value: None.
+template <class T, class Allocator>
+void DoublyLinkedList<T, Allocator>::push_front(T &&item) {
+    emplace_front(std::move(item));
+}
+
+// Emplace front operator. This constructs a new node at the start of the doubly linked list, in place.
+// Parameter: the arguments for the constructor of the new value.
+// Return value: Reference to the new value.
+template <class T, class Allocator>
+template <class... Args>
+T& DoublyLinkedList<T, Allocator>::emplace_front(Args&&... args) {
+    Node* temp = createNode(std::forward<Args>(args)...);
     temp->prev = nullptr;
     temp->next = head;
     if (head != nullptr) {
@@ -248,15 +373,33 @@ void DoublyLinkedList<T>::push_front(const T &item) {
         tail = temp;
     }
     numElements++;
+    cursorIndex++;
+    return temp->value;
 }
 
 // Push back operator. This adds a new node with the 'item' value at the end of the doubly linked list.
 // Parameter: value 'item' to be added.
 // Return value: None.
-template <class T>
-void DoublyLinkedList<T>::push_back(const T &item) {
-    Node* temp = new Node;
-    temp->value = item;
+template <class T, class Allocator>
+void DoublyLinkedList<T, Allocator>::push_back(const T &item) {
+    emplace_back(item);
+}
+
+// Push back operator. This moves 'item' into a new node at the end of the doubly linked list.
+// Parameter: value 'item' to be added.
+// Return value: None.
+template <class T, class Allocator>
+void DoublyLinkedList<T, Allocator>::push_back(T &&item) {
+    emplace_back(std::move(item));
+}
+
+// Emplace back operator. This constructs a new node at the end of the doubly linked list, in place.
+// Parameter: the arguments for the constructor of the new value.
+// Return value: Reference to the new value.
+template <class T, class Allocator>
+template <class... Args>
+T& DoublyLinkedList<T, Allocator>::emplace_back(Args&&... args) {
+    Node* temp = createNode(std::forward<Args>(args)...);
     temp->next = nullptr;
     temp->prev = tail;
 
@@ -268,26 +411,31 @@ void DoublyLinkedList<T>::push_back(const T &item) {
         tail = temp;
     }
     numElements++;
+    return temp->value;
 }
 
 // Pop front operator. This removes the first node of the doubly linked list.
 // Parameter: None.
 // Return value: The value of the removed node.
 // Throws: std::out_of_range if the list is empty.
-template <class T>
-T DoublyLinkedList<T>::pop_front(void) {
+template <class T, class Allocator>
+T DoublyLinkedList<T, Allocator>::pop_front(void) {
     if (numElements == 0) {
         throw out_of_range("The list is empty!");
     }
     T return_value = head->value;
     Node *temp = head;
+    if (cursor == temp) {
+        cursor = nullptr;
+    }
+    cursorIndex--;
     head = head->next;
     if (head != nullptr) {
         head->prev = nullptr;
     } else {
         tail = nullptr; // List becomes empty.
     }
-    delete temp;
+    destroyNode(temp);
     numElements--;
     return return_value;
 }
@@ -296,20 +444,23 @@ T DoublyLinkedList<T>::pop_front(void) {
 // Parameter: None.
 // Return value: The value of the removed node.
 // Throws: std::out_of_range if the list is empty.
-template <class T>
-T DoublyLinkedList<T>::pop_back(void) {
+template <class T, class Allocator>
+T DoublyLinkedList<T, Allocator>::pop_back(void) {
     if (numElements == 0) {
         throw out_of_range("The list is empty");
     }
     T return_value = tail->value;
     Node *temp = tail;
+    if (cursor == temp) {
+        cursor = nullptr;
+    }
     tail = tail->prev;
     if (tail != nullptr) {
         tail->next = nullptr;
     } else {
         head = nullptr; // List becomes empty.
     }
-    delete temp;
+    destroyNode(temp);
     numElements--;
     return return_value;
 }
@@ -318,40 +469,44 @@ T DoublyLinkedList<T>::pop_back(void) {
 // Parameter: The index position to find.
 // Return value: Reference to the value at the given index.
 // Throws: std::out_of_range if the index is out of range.
-template <class T>
-T& DoublyLinkedList<T>::operator[](size_t index) {
+template <class T, class Allocator>
+T& DoublyLinkedList<T, Allocator>::operator[](size_t index) {
     if (index >= numElements) {
         throw out_of_range("Index is out of bounds.");
     }
-    Node* ptr = head;
-    for (size_t i = 0; i < index; i++) {
-        ptr = ptr->next;
-    }
-    return ptr->value; 
+    return getPointer(index)->value;
+}
+
+// Get allocator. This returns a copy of the allocator of the nodes.
+// Parameter: None.
+// Return value: The allocator, rebound to T.
+template <class T, class Allocator>
+Allocator DoublyLinkedList<T, Allocator>::get_allocator(void) const {
+    return Allocator(allocator);
 }
 
 // Size operator. This returns the number of elements in the list.
 // Parameter: None.
 // Return value: The number of elements in the list.
-template <class T>
-size_t DoublyLinkedList<T>::size(void) const {
+template <class T, class Allocator>
+size_t DoublyLinkedList<T, Allocator>::size(void) const {
     return numElements;
 }
 
 // Empty operator. This checks whether the list is empty.
 // Parameter: None.
 // Return value: True if the list is empty, False otherwise.
-template <class T>
-bool DoublyLinkedList<T>::empty(void) const {
+template <class T, class Allocator>
+bool DoublyLinkedList<T, Allocator>::empty(void) const {
     return (numElements == 0);
 }
 
 // Concatenation operator. This returns a new list created by combining the current list with another list.
 // Parameter: The list to be concatenated with the current list.
 // Return value: A new list after concatenation, with the elements of the current list followed by the elements of the other list.
-template <class T>
-DoublyLinkedList<T> DoublyLinkedList<T>::concatenate(const DoublyLinkedList<T> &list) const {
-    DoublyLinkedList<T> result;
+template <class T, class Allocator>
+DoublyLinkedList<T, Allocator> DoublyLinkedList<T, Allocator>::concatenate(const DoublyLinkedList<T, Allocator> &list) const & {
+    DoublyLinkedList<T, Allocator> result;
     Node *temp = head;
     while (temp != nullptr) {
         result.push_back(temp->value);
@@ -365,11 +520,77 @@ DoublyLinkedList<T> DoublyLinkedList<T>::concatenate(const DoublyLinkedList<T> &
     return result;
 }
 
+// Concatenation operator for temporaries. This links the nodes of both lists together instead of copying them.
+// Parameter: The list to be concatenated with the current list; it is left empty.
+// Return value: The current list followed by the elements of the other list.
+template <class T, class Allocator>
+DoublyLinkedList<T, Allocator> DoublyLinkedList<T, Allocator>::concatenate(DoublyLinkedList<T, Allocator> &&list) && {
+    append(std::move(list));
+    return std::move(*this);
+}
+
+// Splice operator. This moves all nodes of another list into the current list, before the given index.
+// Parameter: The index at which the spliced elements start, and the list to splice in, which is left empty.
+// Return value: Throws std::out_of_range if the index is out of range.
+template <class T, class Allocator>
+void DoublyLinkedList<T, Allocator>::splice(size_t index, DoublyLinkedList<T, Allocator> &&list) {
+    if (index > numElements) {
+        throw out_of_range("Index out of range.");
+    }
+    if (list.numElements == 0 || &list == this) {
+        return;
+    }
+    if (!canAdoptNodes(list)) {
+        // The allocators cannot free each other's nodes: move the elements over instead.
+        size_t position = index;
+        while (!list.empty()) {
+            insert(std::move(list.head->value), position++);
+            list.erase(0);
+        }
+        return;
+    }
+
+    // Find the nodes the spliced chain goes between; appending needs no walk.
+    Node *after = (index < numElements) ? getPointer(index) : nullptr;
+    Node *before = (after != nullptr) ? after->prev : tail;
+
+    list.head->prev = before;
+    list.tail->next = after;
+    if (before != nullptr) {
+        before->next = list.head;
+    } else {
+        head = list.head;
+    }
+    if (after != nullptr) {
+        after->prev = list.tail;
+    } else {
+        tail = list.tail;
+    }
+    // The nodes from the cursor on moved up by the spliced elements.
+    if (cursor != nullptr && cursorIndex >= index) {
+        cursorIndex += list.numElements;
+    }
+    numElements += list.numElements;
+
+    list.head = nullptr;
+    list.tail = nullptr;
+    list.numElements = 0;
+    list.cursor = nullptr;
+}
+
+// Append operator. This moves all nodes of another list to the end of the current list in O(1).
+// Parameter: The list to append, which is left empty.
+// Return value: None.
+template <class T, class Allocator>
+void DoublyLinkedList<T, Allocator>::append(DoublyLinkedList<T, Allocator> &&list) {
+    splice(numElements, std::move(list));
+}
+
 // Equality operator. This checks whether rhs list is equal to the current list.
 // Parameter: rhs list.
 // Return value: True if the lists are equal, False otherwise.
-template <class T>
-bool DoublyLinkedList<T>::operator==(const DoublyLinkedList<T> &rhs) const {
+template <class T, class Allocator>
+bool DoublyLinkedList<T, Allocator>::operator==(const DoublyLinkedList<T, Allocator> &rhs) const {
     if (numElements != rhs.numElements) {
         return false;
     }
@@ -388,7 +609,39 @@ bool DoublyLinkedList<T>::operator==(const DoublyLinkedList<T> &rhs) const {
 // Inequality operator. This checks whether rhs list is different from the current list.
 // Parameter: rhs list.
 // Return value: True if the lists are different, False otherwise.
-template <class T>
-bool DoublyLinkedList<T>::operator!=(const DoublyLinkedList<T> &rhs) const {
+template <class T, class Allocator>
+bool DoublyLinkedList<T, Allocator>::operator!=(const DoublyLinkedList<T, Allocator> &rhs) const {
     return !(*this == rhs);
 }
+
+// Begin. This returns an iterator to the head of the list.
+// Parameter: None.
+// Return value: An iterator to the first element, or end() if the list is empty.
+template <class T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::iterator DoublyLinkedList<T, Allocator>::begin(void) {
+    return iterator(head, this);
+}
+
+// End. This returns the past-the-end iterator of the list.
+// Parameter: None.
+// Return value: The past-the-end iterator.
+template <class T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::iterator DoublyLinkedList<T, Allocator>::end(void) {
+    return iterator(nullptr, this);
+}
+
+// Begin. This returns a read-only iterator to the head of the list.
+// Parameter: None.
+// Return value: An iterator to the first element, or end() if the list is empty.
+template <class T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::const_iterator DoublyLinkedList<T, Allocator>::begin(void) const {
+    return const_iterator(head, this);
+}
+
+// End. This returns the read-only past-the-end iterator of the list.
+// Parameter: None.
+// Return value: The past-the-end iterator.
+template <class T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::const_iterator DoublyLinkedList<T, Allocator>::end(void) const {
+    return const_iterator(nullptr, this);
+}
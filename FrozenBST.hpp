@@ -0,0 +1,110 @@
+/*
+File name: FrozenBST.hpp
+Creation Date: 10/16/2026
+Description: Header file for the FrozenBST<> templated class, an immutable read-optimized snapshot of a BST<>
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+FrozenBST stores the values of a tree in Eytzinger order: a flat array where the root is at index 1 and the
+children of the value at index k are at 2k and 2k + 1. There are no parent/left/right pointers, the top levels of
+the tree share a handful of cache lines, and lookups descend with a branchless loop that prefetches the
+descendants four levels ahead, so several cache misses are in flight at once.
+
+The snapshot is built by BST<>::freeze() (or directly from values already in order) and never changes. The
+comparator follows the BST<> convention: comparator(a, b) is true if a <= b.
+
+For trivially copyable T, save() writes the array to a file as it is, after a FrozenSnapshotHeader: a file of n
+values holds the header and then the n + 1 values of the array, index 0 included. Since the Eytzinger order is the
+level order of a complete tree, the file describes the shape of a balanced tree too. MappedBST<> (see
+MappedBST.hpp) searches such a file in place, and BST<>::load rebuilds a tree from it without comparisons.
+*/
+
+// Header of a snapshot file; 32 bytes, so the values after it are aligned for any T aligned to 32 bytes or less.
+struct FrozenSnapshotHeader {
+    static const uint32_t currentVersion = 1;
+    // written as is, so a file from a machine of the other byte order is detected
+    static const uint32_t byteOrderMark = 0x01020304;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t valueSize;
+    uint64_t count;
+
+    // checks that the header is one written by save for values of valueSize bytes, followed by payloadBytes
+    // bytes that hold exactly the values it counts
+    bool describes(uint64_t valueSize, uint64_t payloadBytes) const;
+};
+
+
+template<class T, typename Comparator>
+class MappedBST;
+
+
+template<class T, typename Comparator = std::less_equal<T> >
+class FrozenBST {
+    // mapped snapshots are searched with the same descent
+    template<class U, typename MappedComparator>
+    friend class MappedBST;
+
+    private:
+    // values in Eytzinger order, 1-based; index 0 is padding
+    std::vector<T> values;
+    size_t numValues;
+    Comparator comparator;
+
+    // fills values[k..] with the next in-order values from next, in the order of the implicit tree
+    template<class ForwardIt>
+    void layout(ForwardIt &next, size_t k);
+
+    // index of the first value that is not less than value, 0 if there is none
+    size_t lowerBoundIndex(const T &value) const;
+    // the same, over the array data of numValues values in Eytzinger order
+    static size_t lowerBoundIndex(const T *data, size_t numValues, const T &value, const Comparator &comparator);
+
+
+    public:
+    // default constructor; an empty snapshot
+    FrozenBST(Comparator comparator = Comparator());
+
+
+    // sorted range constructor; [first, last) must already be in order
+    template<class ForwardIt>
+    FrozenBST(ForwardIt first, ForwardIt last, Comparator comparator = Comparator());
+
+
+    // checks if is empty
+    bool empty(void) const;
+
+
+    // size
+    size_t size(void) const;
+
+
+    // search
+    // returns a pointer to a value equal to value, or nullptr if there is none
+    const T* search(const T &value) const;
+
+
+    // contains
+    bool contains(const T &value) const;
+
+
+    // lower bound
+    // returns a pointer to the smallest value that is not less than value, or nullptr if there is none
+    const T* lower_bound(const T &value) const;
+
+
+    // save
+    // writes the snapshot to the file at path, replacing it; T must be trivially copyable
+    // throws std::runtime_error if the file cannot be written
+    void save(const std::string &path) const;
+};
@@ -0,0 +1,189 @@
+/*
+FrozenBST.tpp
+A file that contains the implementation of the FrozenBST class methods in the FrozenBST.hpp file.
+*/
+
+#pragma once
+
+#include "FrozenBST.hpp"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+
+using namespace std;
+
+// Describes function.
+// Description: This function checks the magic, version, byte order and value size of a snapshot header, and that
+// the payload after it holds the n + 1 entries of the array for n values, or nothing for n == 0. The payload is
+// checked to be nonempty before 1 is subtracted from it, so a header-only file cannot claim 2^64 - 1 values.
+// Parameters: the size of the values expected, the number of bytes after the header.
+// Return value: true if the file is a snapshot of such values, and false otherwise.
+inline bool FrozenSnapshotHeader::describes(uint64_t valueSize, uint64_t payloadBytes) const{
+    if (memcmp(magic, "FROZBST", sizeof(magic)) != 0 || version != currentVersion || byteOrder != byteOrderMark
+        || this->valueSize != valueSize || valueSize == 0 || payloadBytes % valueSize != 0){
+        return false;
+    }
+    uint64_t stored = payloadBytes / valueSize;
+    return (count == 0) ? stored == 0 : stored >= 1 && stored - 1 == count;
+}
+
+// Default constructor.
+// Description: This function constructs an empty snapshot.
+// Parameters: the comparator.
+// Return value: NONE.
+template<class T, typename Comparator>
+FrozenBST<T,Comparator>::FrozenBST(Comparator comparator){
+    numValues = 0;
+    this->comparator = comparator;
+}
+
+// Sorted range constructor.
+// Description: This function lays out values that are already in order in Eytzinger order.
+// Parameters: the range of values, the comparator.
+// Return value: NONE.
+template<class T, typename Comparator>
+template<class ForwardIt>
+FrozenBST<T,Comparator>::FrozenBST(ForwardIt first, ForwardIt last, Comparator comparator){
+    numValues = distance(first, last);
+    this->comparator = comparator;
+    if (numValues == 0){
+        return;
+    }
+    // Index 0 is never read; it holds a copy of the first value so that T needs no default constructor.
+    values.reserve(numValues + 1);
+    values.assign(numValues + 1, *first);
+    layout(first, 1);
+}
+
+// Layout function.
+// Description: This function walks the implicit tree rooted at index k in order, assigning it the next values.
+// Parameters: an iterator to the next value, advanced past the values used; the index of the subtree root.
+// Return value: NONE.
+template<class T, typename Comparator>
+template<class ForwardIt>
+void FrozenBST<T,Comparator>::layout(ForwardIt &next, size_t k){
+    if (k > numValues){
+        return;
+    }
+    layout(next, 2 * k);
+    values[k] = *next;
+    ++next;
+    layout(next, 2 * k + 1);
+}
+
+// Lower bound index function.
+// Description: This function finds the lower bound in the snapshot's own array.
+// Parameters: the value to look for.
+// Return value: the index of the lower bound, or 0 if every value is less than value.
+template<class T, typename Comparator>
+size_t FrozenBST<T,Comparator>::lowerBoundIndex(const T &value) const{
+    return lowerBoundIndex(values.data(), numValues, value, comparator);
+}
+
+// Lower bound index function.
+// Description: This function descends the implicit tree without branching on the comparisons: every step goes
+// to 2k if the value at k is not less than value, and to 2k + 1 otherwise. The path taken encodes the answer:
+// the last left turn is where the lower bound is, and stripping the trailing right turns recovers its index.
+// Parameters: the array in Eytzinger order, the number of values in it, the value to look for, the comparator.
+// Return value: the index of the lower bound, or 0 if every value is less than value.
+template<class T, typename Comparator>
+size_t FrozenBST<T,Comparator>::lowerBoundIndex(const T *data, size_t numValues, const T &value, const Comparator &comparator){
+    size_t k = 1;
+    while (k <= numValues){
+#if defined(__GNUC__)
+        // the 16 descendants four levels down are contiguous, starting at 16k
+        size_t ahead = 16 * k;
+        __builtin_prefetch(data + ((ahead <= numValues) ? ahead : 0));
+#endif
+        // comparator(value, x) means value <= x, so x < value exactly when it does not hold
+        k = 2 * k + !comparator(value, data[k]);
+    }
+    // Drop the trailing right turns and the final left turn.
+#if defined(__GNUC__)
+    k >>= __builtin_ffsll(~static_cast<long long>(k));
+#else
+    while (k & 1){
+        k >>= 1;
+    }
+    k >>= 1;
+#endif
+    return k;
+}
+
+// Checks if is empty.
+// Description: This function checks if the snapshot is empty.
+// Parameters: NONE.
+// Return value: true if the snapshot is empty, and false otherwise.
+template<class T, typename Comparator>
+bool FrozenBST<T,Comparator>::empty(void) const{
+    return numValues == 0;
+}
+
+// Size.
+// Description: This function returns the number of values in the snapshot.
+// Parameters: NONE.
+// Return value: the number of values.
+template<class T, typename Comparator>
+size_t FrozenBST<T,Comparator>::size(void) const{
+    return numValues;
+}
+
+// Search function.
+// Description: This function looks for a value equal to the given one.
+// Parameters: a value to be searched.
+// Return value: a pointer to the value, or nullptr if the value is not found.
+template<class T, typename Comparator>
+const T* FrozenBST<T,Comparator>::search(const T &value) const{
+    size_t k = lowerBoundIndex(value);
+    // values[k] is not less than value, so it is equal if it is also <= value
+    if (k == 0 || !comparator(values[k], value)){
+        return nullptr;
+    }
+    return &values[k];
+}
+
+// Contains function.
+// Description: This function checks if a value equal to the given one is in the snapshot.
+// Parameters: a value to be searched.
+// Return value: true if the value is found, and false otherwise.
+template<class T, typename Comparator>
+bool FrozenBST<T,Comparator>::contains(const T &value) const{
+    return search(value) != nullptr;
+}
+
+// Lower bound function.
+// Description: This function finds the smallest value that is not less than the given one.
+// Parameters: a value.
+// Return value: a pointer to the lower bound, or nullptr if every value is less than the given one.
+template<class T, typename Comparator>
+const T* FrozenBST<T,Comparator>::lower_bound(const T &value) const{
+    size_t k = lowerBoundIndex(value);
+    return (k == 0) ? nullptr : &values[k];
+}
+
+// Save function.
+// Description: This function writes a header and then the array, index 0 included, to a file, so that the file
+// can be searched in place by MappedBST or loaded by BST::load.
+// Parameters: the path of the file.
+// Return value: NONE.
+// throws std::runtime_error if the file cannot be written.
+template<class T, typename Comparator>
+void FrozenBST<T,Comparator>::save(const string &path) const{
+    static_assert(is_trivially_copyable<T>::value, "only trivially copyable values can be saved");
+    FrozenSnapshotHeader header;
+    memcpy(header.magic, "FROZBST", sizeof(header.magic));
+    header.version = FrozenSnapshotHeader::currentVersion;
+    header.byteOrder = FrozenSnapshotHeader::byteOrderMark;
+    header.valueSize = sizeof(T);
+    header.count = numValues;
+    ofstream file(path.c_str(), ios::binary | ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (numValues != 0){
+        file.write(reinterpret_cast<const char*>(values.data()), (numValues + 1) * sizeof(T));
+    }
+    file.close();
+    if (!file){
+        throw runtime_error("Could not write " + path);
+    }
+}
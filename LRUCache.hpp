@@ -0,0 +1,157 @@
+/*
+File name: LRUCache.hpp
+Creation Date: 10/16/2026
+Description: Header file for the LRUCache<> templated class, a bounded ordered map that evicts its least recently
+used entry
+*/
+
+#pragma once
+
+#include "BST.hpp"
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+/*
+LRUCache holds at most capacity entries, each mapping a key to a value. The entries are the nodes of a BST<>
+ordered by key, which gives lookups and range queries in O(height), and each node also links to the entries used
+just before and just after it. That recency list is threaded through the tree's own nodes: moving an entry to
+the front is a few pointer updates, and when an insertion goes over the capacity the entry at the back is erased
+through its node, without a search.
+
+get() counts as a use and moves the entry to the front; peek(), contains() and the range visitor do not. get()
+also counts hits and misses, and put() counts evictions. The default balancing policy is AVLBalance, so that
+lookups stay O(log n) whatever the order keys arrive in. The comparator follows the BST<> convention:
+comparator(a, b) is true if a <= b.
+*/
+template<class K, class V, typename Comparator = std::less_equal<K>, typename Balance = AVLBalance, typename Allocator = PoolAllocator<K> >
+class LRUCache {
+
+    private:
+    struct Entry;
+    typedef BSTNode<Entry> Node;
+
+    struct Entry {
+        K key;
+        V value;
+        // neighbours in the recency list: the entry used next after this one, and the one used just before
+        Node *newer;
+        Node *older;
+
+        Entry(const K &key, const V &value) : key(key), value(value), newer(nullptr), older(nullptr) {}
+    };
+
+    struct EntryComparator {
+        Comparator comparator;
+
+        bool operator()(const Entry &a, const Entry &b) const { return comparator(a.key, b.key); }
+    };
+
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Entry> EntryAllocator;
+    typedef BST<Entry, EntryComparator, Balance, EntryAllocator> Tree;
+
+    Tree tree;
+    // the ends of the recency list
+    Node *newest;
+    Node *oldest;
+    size_t maxEntries;
+    Comparator comparator;
+    size_t numHits;
+    size_t numMisses;
+    size_t numEvictions;
+
+    // node holding key, NULL if there is none
+    Node* findNode(const K &key) const;
+    // takes node out of the recency list
+    void unlink(Node *node);
+    // puts node at the front of the recency list
+    void pushNewest(Node *node);
+    // erases node from the list and the tree
+    void eraseNode(Node *node);
+
+
+    public:
+    // constructor; capacity is the most entries the cache holds
+    // throws std::invalid_argument if capacity is 0
+    explicit LRUCache(size_t capacity, Comparator comparator = Comparator(), const Allocator &allocator = Allocator());
+
+
+    // copy constructor; copies the entries and their order of use, but starts new counters
+    LRUCache(const LRUCache<K, V, Comparator, Balance, Allocator> &cache);
+
+
+    // move constructor; cache is left empty
+    LRUCache(LRUCache<K, V, Comparator, Balance, Allocator> &&cache) noexcept;
+
+
+    // assignment operator; cache is already a copy (or was moved), and its contents are swapped in
+    LRUCache<K, V, Comparator, Balance, Allocator>& operator=(LRUCache<K, V, Comparator, Balance, Allocator> cache);
+
+
+    // checks if is empty
+    bool empty(void) const;
+
+
+    // size
+    size_t size(void) const;
+
+
+    // capacity; the most entries the cache holds
+    size_t capacity(void) const;
+
+
+    // get; the value of key, which becomes the most recently used entry, or nullptr if there is none
+    // counts a hit or a miss
+    V* get(const K &key);
+
+
+    // peek; the value of key without using it, or nullptr if there is none
+    const V* peek(const K &key) const;
+
+
+    // contains; checks for key without using it
+    bool contains(const K &key) const;
+
+
+    // put; inserts key with value, or assigns value to key, which becomes the most recently used entry. If that
+    // makes the cache hold more than capacity entries, the least recently used one is evicted. Returns the value.
+    V& put(const K &key, const V &value);
+
+
+    // erase; removes key, returns false if there was none
+    bool erase(const K &key);
+
+
+    // clear; removes every entry; the counters are kept
+    void clear(void);
+
+
+    // least recently used key, which put evicts next
+    // throws std::length_error if the cache is empty
+    const K& leastRecent(void) const;
+
+
+    // most recently used key
+    // throws std::length_error if the cache is empty
+    const K& mostRecent(void) const;
+
+
+    // visitRange; calls visit(key, value) on every entry with lo <= key <= hi, in key order, without using them
+    template<class Visitor>
+    void visitRange(const K &lo, const K &hi, Visitor visit) const;
+
+
+    // visitRecent; calls visit(key, value) on every entry, from the most to the least recently used
+    template<class Visitor>
+    void visitRecent(Visitor visit) const;
+
+
+    // counters: lookups by get that found their key and that did not, and entries evicted by put
+    size_t hits(void) const;
+    size_t misses(void) const;
+    size_t evictions(void) const;
+
+
+    // resetCounters; sets the three counters back to 0
+    void resetCounters(void);
+};
@@ -0,0 +1,400 @@
+/*
+LRUCache.tpp
+A file that contains the implementation of the LRUCache class methods in the LRUCache.hpp file.
+*/
+
+#pragma once
+
+#include "LRUCache.hpp"
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+// Constructor.
+// Description: This function constructs an empty cache.
+// Parameters: the most entries the cache holds, the comparator, the allocator.
+// Return value: NONE.
+// throws std::invalid_argument if capacity is 0.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+LRUCache<K,V,Comparator,Balance,Allocator>::LRUCache(size_t capacity, Comparator comparator, const Allocator &allocator)
+    : tree(EntryComparator{comparator}, EntryAllocator(allocator)), comparator(comparator){
+    if (capacity == 0){
+        throw invalid_argument("The capacity of a cache must be positive");
+    }
+    newest = NULL;
+    oldest = NULL;
+    maxEntries = capacity;
+    numHits = 0;
+    numMisses = 0;
+    numEvictions = 0;
+}
+
+// Copy constructor.
+// Description: This function constructs a cache with the entries of another one, inserted from the least to the
+// most recently used so that the copy keeps their order of use.
+// Parameters: a given cache.
+// Return value: NONE.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+LRUCache<K,V,Comparator,Balance,Allocator>::LRUCache(const LRUCache<K, V, Comparator, Balance, Allocator> &cache)
+    : tree(EntryComparator{cache.comparator}), comparator(cache.comparator){
+    newest = NULL;
+    oldest = NULL;
+    maxEntries = cache.maxEntries;
+    numHits = 0;
+    numMisses = 0;
+    numEvictions = 0;
+    for (Node *node = cache.oldest; node != NULL; node = node->getValue().newer){
+        put(node->getValue().key, node->getValue().value);
+    }
+}
+
+// Move constructor.
+// Description: This function takes over the entries and counters of another cache, which is left empty.
+// Parameters: a given cache.
+// Return value: NONE.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+LRUCache<K,V,Comparator,Balance,Allocator>::LRUCache(LRUCache<K, V, Comparator, Balance, Allocator> &&cache) noexcept
+    : tree(std::move(cache.tree)), comparator(cache.comparator){
+    newest = cache.newest;
+    oldest = cache.oldest;
+    maxEntries = cache.maxEntries;
+    numHits = cache.numHits;
+    numMisses = cache.numMisses;
+    numEvictions = cache.numEvictions;
+    cache.newest = NULL;
+    cache.oldest = NULL;
+    cache.resetCounters();
+}
+
+// Assignment operator.
+// Description: This function swaps the contents of a copied (or moved) cache in; the old entries are destroyed
+// with it.
+// Parameters: a given cache.
+// Return value: this cache.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+LRUCache<K, V, Comparator, Balance, Allocator>& LRUCache<K,V,Comparator,Balance,Allocator>::operator=(LRUCache<K, V, Comparator, Balance, Allocator> cache){
+    // moving a tree into another swaps them
+    tree = std::move(cache.tree);
+    swap(newest, cache.newest);
+    swap(oldest, cache.oldest);
+    swap(maxEntries, cache.maxEntries);
+    swap(comparator, cache.comparator);
+    swap(numHits, cache.numHits);
+    swap(numMisses, cache.numMisses);
+    swap(numEvictions, cache.numEvictions);
+    return *this;
+}
+
+// Find node function.
+// Description: This function descends to the first key not less than the given one, one comparison per level,
+// and checks it for equality once.
+// Parameters: a key.
+// Return value: the node holding key, or NULL if there is none.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+typename LRUCache<K,V,Comparator,Balance,Allocator>::Node* LRUCache<K,V,Comparator,Balance,Allocator>::findNode(const K &key) const{
+    Node *candidate = NULL;
+    Node *current = tree.root;
+    while (current != NULL){
+        if (comparator(key, current->getValue().key)){
+            candidate = current;
+            current = current->getLeftChild();
+        }
+        else{
+            current = current->getRightChild();
+        }
+    }
+    // candidate is not less than key, so it is equal if it is also <= key
+    if (candidate != NULL && comparator(candidate->getValue().key, key)){
+        return candidate;
+    }
+    return NULL;
+}
+
+// Unlink function.
+// Description: This function takes a node out of the recency list, joining its neighbours.
+// Parameters: a node in the list.
+// Return value: NONE.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+void LRUCache<K,V,Comparator,Balance,Allocator>::unlink(Node *node){
+    Entry &entry = node->getValue();
+    if (entry.newer != NULL){
+        entry.newer->getValue().older = entry.older;
+    }
+    else{
+        newest = entry.older;
+    }
+    if (entry.older != NULL){
+        entry.older->getValue().newer = entry.newer;
+    }
+    else{
+        oldest = entry.newer;
+    }
+    entry.newer = NULL;
+    entry.older = NULL;
+}
+
+// Push newest function.
+// Description: This function puts a node that is not in the recency list at its front.
+// Parameters: a node.
+// Return value: NONE.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+void LRUCache<K,V,Comparator,Balance,Allocator>::pushNewest(Node *node){
+    Entry &entry = node->getValue();
+    entry.newer = NULL;
+    entry.older = newest;
+    if (newest != NULL){
+        newest->getValue().newer = node;
+    }
+    else{
+        oldest = node;
+    }
+    newest = node;
+}
+
+// Erase node function.
+// Description: This function removes an entry from the recency list and erases its node from the tree. Rotations
+// and erasing only relink nodes, so the list links of the other entries stay valid.
+// Parameters: a node of the tree.
+// Return value: NONE.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+void LRUCache<K,V,Comparator,Balance,Allocator>::eraseNode(Node *node){
+    unlink(node);
+    tree.erase(node);
+}
+
+// Checks if is empty.
+// Description: This function checks if the cache is empty.
+// Parameters: NONE.
+// Return value: true if the cache is empty, and false otherwise.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+bool LRUCache<K,V,Comparator,Balance,Allocator>::empty(void) const{
+    return tree.empty();
+}
+
+// Size.
+// Description: This function returns the number of entries.
+// Parameters: NONE.
+// Return value: the number of entries.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+size_t LRUCache<K,V,Comparator,Balance,Allocator>::size(void) const{
+    return tree.size();
+}
+
+// Capacity.
+// Description: This function returns the most entries the cache holds.
+// Parameters: NONE.
+// Return value: the capacity.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+size_t LRUCache<K,V,Comparator,Balance,Allocator>::capacity(void) const{
+    return maxEntries;
+}
+
+// Get function.
+// Description: This function looks a key up and, if it is there, moves its entry to the front of the recency
+// list in O(1).
+// Parameters: a key.
+// Return value: a pointer to the value of key, or nullptr if there is none.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+V* LRUCache<K,V,Comparator,Balance,Allocator>::get(const K &key){
+    Node *node = findNode(key);
+    if (node == NULL){
+        numMisses++;
+        return nullptr;
+    }
+    numHits++;
+    if (node != newest){
+        unlink(node);
+        pushNewest(node);
+    }
+    return &node->getValue().value;
+}
+
+// Peek function.
+// Description: This function looks a key up without changing the order of use or the counters.
+// Parameters: a key.
+// Return value: a pointer to the value of key, or nullptr if there is none.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+const V* LRUCache<K,V,Comparator,Balance,Allocator>::peek(const K &key) const{
+    Node *node = findNode(key);
+    return (node == NULL) ? nullptr : &node->getValue().value;
+}
+
+// Contains function.
+// Description: This function checks for a key without changing the order of use or the counters.
+// Parameters: a key.
+// Return value: true if the key is in the cache, and false otherwise.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+bool LRUCache<K,V,Comparator,Balance,Allocator>::contains(const K &key) const{
+    return findNode(key) != NULL;
+}
+
+// Put function.
+// Description: This function descends once, as findNode does, keeping track of where a new leaf would go. An
+// existing entry gets the new value; otherwise a node is linked where the descent ended, and if that goes over
+// the capacity the node at the back of the recency list is erased.
+// Parameters: a key, a value.
+// Return value: a reference to the value stored for key.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+V& LRUCache<K,V,Comparator,Balance,Allocator>::put(const K &key, const V &value){
+    Node *candidate = NULL;
+    Node *parent = NULL;
+    Node *current = tree.root;
+    bool goLeft = false;
+    while (current != NULL){
+        parent = current;
+        goLeft = comparator(key, current->getValue().key);
+        if (goLeft){
+            candidate = current;
+            current = current->getLeftChild();
+        }
+        else{
+            current = current->getRightChild();
+        }
+    }
+    Node *node = candidate;
+    if (candidate != NULL && comparator(candidate->getValue().key, key)){
+        candidate->getValue().value = value;
+        if (candidate != newest){
+            unlink(candidate);
+            pushNewest(candidate);
+        }
+    }
+    else{
+        node = tree.emplaceNode(key, value);
+        tree.linkNode(parent, node, goLeft);
+        pushNewest(node);
+        if (tree.size() > maxEntries){
+            eraseNode(oldest);
+            numEvictions++;
+        }
+    }
+    return node->getValue().value;
+}
+
+// Erase function.
+// Description: This function removes the entry of a key.
+// Parameters: a key.
+// Return value: true if an entry was removed, false if the key was absent.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+bool LRUCache<K,V,Comparator,Balance,Allocator>::erase(const K &key){
+    Node *node = findNode(key);
+    if (node == NULL){
+        return false;
+    }
+    eraseNode(node);
+    return true;
+}
+
+// Clear function.
+// Description: This function removes every entry, keeping the counters.
+// Parameters: NONE.
+// Return value: NONE.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+void LRUCache<K,V,Comparator,Balance,Allocator>::clear(void){
+    tree.deleteSubTree(tree.root);
+    tree.root = NULL;
+    tree.numNodes = 0;
+    newest = NULL;
+    oldest = NULL;
+}
+
+// Least recent function.
+// Description: This function returns the key at the back of the recency list.
+// Parameters: NONE.
+// Return value: the least recently used key.
+// throws std::length_error if the cache is empty.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+const K& LRUCache<K,V,Comparator,Balance,Allocator>::leastRecent(void) const{
+    if (oldest == NULL){
+        throw length_error("Cache is empty!");
+    }
+    return oldest->getValue().key;
+}
+
+// Most recent function.
+// Description: This function returns the key at the front of the recency list.
+// Parameters: NONE.
+// Return value: the most recently used key.
+// throws std::length_error if the cache is empty.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+const K& LRUCache<K,V,Comparator,Balance,Allocator>::mostRecent(void) const{
+    if (newest == NULL){
+        throw length_error("Cache is empty!");
+    }
+    return newest->getValue().key;
+}
+
+// Range visitor.
+// Description: This function calls visit(key, value) on every entry with lo <= key <= hi, in key order. It
+// descends once to the first key not less than lo and then follows successors until it passes hi.
+// Parameters: the bounds of the range, both inclusive; a callable taking a key and a value.
+// Return value: NONE.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+template<class Visitor>
+void LRUCache<K,V,Comparator,Balance,Allocator>::visitRange(const K &lo, const K &hi, Visitor visit) const{
+    Node *current = NULL;
+    for (Node *node = tree.root; node != NULL;){
+        if (comparator(lo, node->getValue().key)){
+            current = node;
+            node = node->getLeftChild();
+        }
+        else{
+            node = node->getRightChild();
+        }
+    }
+    while (current != NULL && comparator(current->getValue().key, hi)){
+        visit(current->getValue().key, current->getValue().value);
+        current = current->successor();
+    }
+}
+
+// Recency visitor.
+// Description: This function calls visit(key, value) on every entry, walking the recency list from the front.
+// Parameters: a callable taking a key and a value.
+// Return value: NONE.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+template<class Visitor>
+void LRUCache<K,V,Comparator,Balance,Allocator>::visitRecent(Visitor visit) const{
+    for (Node *node = newest; node != NULL; node = node->getValue().older){
+        visit(node->getValue().key, node->getValue().value);
+    }
+}
+
+// Hits.
+// Description: This function returns how many lookups by get found their key.
+// Parameters: NONE.
+// Return value: the number of hits.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+size_t LRUCache<K,V,Comparator,Balance,Allocator>::hits(void) const{
+    return numHits;
+}
+
+// Misses.
+// Description: This function returns how many lookups by get did not find their key.
+// Parameters: NONE.
+// Return value: the number of misses.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+size_t LRUCache<K,V,Comparator,Balance,Allocator>::misses(void) const{
+    return numMisses;
+}
+
+// Evictions.
+// Description: This function returns how many entries put evicted to stay within the capacity.
+// Parameters: NONE.
+// Return value: the number of evictions.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+size_t LRUCache<K,V,Comparator,Balance,Allocator>::evictions(void) const{
+    return numEvictions;
+}
+
+// Reset counters.
+// Description: This function sets the hit, miss and eviction counters back to 0.
+// Parameters: NONE.
+// Return value: NONE.
+template<class K, class V, typename Comparator, typename Balance, typename Allocator>
+void LRUCache<K,V,Comparator,Balance,Allocator>::resetCounters(void){
+    numHits = 0;
+    numMisses = 0;
+    numEvictions = 0;
+}
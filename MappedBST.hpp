@@ -0,0 +1,86 @@
+/*
+File name: MappedBST.hpp
+Creation Date: 10/16/2026
+Description: Header file for the MappedBST<> templated class, a read-only view of a saved snapshot file
+*/
+
+#pragma once
+
+#include "FrozenBST.hpp"
+#include "FrozenBST.tpp"
+#include <cstddef>
+#include <functional>
+#include <string>
+
+/*
+MappedBST maps a file written by BST<>::save or FrozenBST<>::save into memory (POSIX mmap) and searches it in
+place, with the same Eytzinger descent as FrozenBST. Opening one reads only the header, so startup does not
+depend on the size of the file: pages are read by the operating system as the searches first touch them, and are
+shared with every other process that maps the same file. The returned pointers point into the mapping and stay
+valid as long as the MappedBST does.
+
+The file must have been written for the same T on a machine with the same byte order; the header is checked, and
+a mismatch throws. The comparator follows the BST<> convention: comparator(a, b) is true if a <= b.
+
+This header depends on POSIX (mmap), so BST.hpp does not include it; include MappedBST.hpp and MappedBST.tpp
+where a mapped view is needed.
+*/
+template<class T, typename Comparator = std::less_equal<T> >
+class MappedBST {
+    private:
+    // the whole mapping, header included; nullptr if empty
+    void *mapping;
+    size_t mappingSize;
+    // values in Eytzinger order, 1-based, inside the mapping
+    const T *values;
+    size_t numValues;
+    Comparator comparator;
+
+    // unmaps the file
+    void unmap(void);
+
+
+    public:
+    // maps the snapshot file at path
+    // throws std::runtime_error if the file cannot be opened or mapped, or is not a snapshot of T
+    explicit MappedBST(const std::string &path, Comparator comparator = Comparator());
+
+
+    // a mapping has a single owner
+    MappedBST(const MappedBST<T, Comparator> &view) = delete;
+    MappedBST<T, Comparator>& operator=(const MappedBST<T, Comparator> &view) = delete;
+
+
+    // move constructor; view is left empty
+    MappedBST(MappedBST<T, Comparator> &&view) noexcept;
+
+
+    // move assignment operator; swaps the mappings
+    MappedBST<T, Comparator>& operator=(MappedBST<T, Comparator> &&view) noexcept;
+
+
+    // destructor; unmaps the file
+    ~MappedBST(void);
+
+
+    // checks if is empty
+    bool empty(void) const;
+
+
+    // size
+    size_t size(void) const;
+
+
+    // search
+    // returns a pointer to a value equal to value, or nullptr if there is none
+    const T* search(const T &value) const;
+
+
+    // contains
+    bool contains(const T &value) const;
+
+
+    // lower bound
+    // returns a pointer to the smallest value that is not less than value, or nullptr if there is none
+    const T* lower_bound(const T &value) const;
+};
@@ -0,0 +1,164 @@
+/*
+MappedBST.tpp
+A file that contains the implementation of the MappedBST class methods in the MappedBST.hpp file.
+*/
+
+#pragma once
+
+#include "MappedBST.hpp"
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+// Constructor.
+// Description: This function maps a snapshot file and checks its header against T. Only the header is read.
+// Parameters: the path of the file, the comparator.
+// Return value: NONE.
+// throws std::runtime_error if the file cannot be opened or mapped, or is not a snapshot of T.
+template<class T, typename Comparator>
+MappedBST<T,Comparator>::MappedBST(const string &path, Comparator comparator){
+    static_assert(is_trivially_copyable<T>::value, "only trivially copyable values can be mapped");
+    static_assert(alignof(T) <= sizeof(FrozenSnapshotHeader), "the values after the header would be misaligned");
+    mapping = nullptr;
+    mappingSize = 0;
+    values = nullptr;
+    numValues = 0;
+    this->comparator = comparator;
+
+    int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0){
+        throw runtime_error("Could not open " + path);
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(FrozenSnapshotHeader)){
+        close(descriptor);
+        throw runtime_error(path + " is not a snapshot file");
+    }
+    mappingSize = status.st_size;
+    mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, descriptor, 0);
+    // the mapping keeps the file open on its own
+    close(descriptor);
+    if (mapping == MAP_FAILED){
+        mapping = nullptr;
+        throw runtime_error("Could not map " + path);
+    }
+
+    const FrozenSnapshotHeader *header = static_cast<const FrozenSnapshotHeader*>(mapping);
+    if (!header->describes(sizeof(T), mappingSize - sizeof(FrozenSnapshotHeader))){
+        unmap();
+        throw runtime_error(path + " is not a snapshot of this type");
+    }
+    numValues = header->count;
+    values = reinterpret_cast<const T*>(static_cast<const char*>(mapping) + sizeof(FrozenSnapshotHeader));
+    // lookups jump around the file; reading ahead would only waste memory
+    madvise(mapping, mappingSize, MADV_RANDOM);
+}
+
+// Move constructor.
+// Description: This function takes over the mapping of another view, leaving it empty.
+// Parameters: a given view.
+// Return value: NONE.
+template<class T, typename Comparator>
+MappedBST<T,Comparator>::MappedBST(MappedBST<T, Comparator> &&view) noexcept{
+    mapping = view.mapping;
+    mappingSize = view.mappingSize;
+    values = view.values;
+    numValues = view.numValues;
+    comparator = view.comparator;
+    view.mapping = nullptr;
+    view.mappingSize = 0;
+    view.values = nullptr;
+    view.numValues = 0;
+}
+
+// Move assignment operator.
+// Description: This function swaps the mappings of two views; the old one is unmapped with view.
+// Parameters: a given view.
+// Return value: this view.
+template<class T, typename Comparator>
+MappedBST<T, Comparator>& MappedBST<T,Comparator>::operator=(MappedBST<T, Comparator> &&view) noexcept{
+    swap(mapping, view.mapping);
+    swap(mappingSize, view.mappingSize);
+    swap(values, view.values);
+    swap(numValues, view.numValues);
+    swap(comparator, view.comparator);
+    return *this;
+}
+
+// Destructor.
+// Description: This function unmaps the file.
+// Parameters: NONE.
+// Return value: NONE.
+template<class T, typename Comparator>
+MappedBST<T,Comparator>::~MappedBST(void){
+    unmap();
+}
+
+// Unmap function.
+// Description: This function releases the mapping, if any.
+// Parameters: NONE.
+// Return value: NONE.
+template<class T, typename Comparator>
+void MappedBST<T,Comparator>::unmap(void){
+    if (mapping != nullptr){
+        munmap(mapping, mappingSize);
+        mapping = nullptr;
+    }
+}
+
+// Checks if is empty.
+// Description: This function checks if the snapshot is empty.
+// Parameters: NONE.
+// Return value: true if the snapshot is empty, and false otherwise.
+template<class T, typename Comparator>
+bool MappedBST<T,Comparator>::empty(void) const{
+    return numValues == 0;
+}
+
+// Size.
+// Description: This function returns the number of values in the snapshot.
+// Parameters: NONE.
+// Return value: the number of values.
+template<class T, typename Comparator>
+size_t MappedBST<T,Comparator>::size(void) const{
+    return numValues;
+}
+
+// Search function.
+// Description: This function looks for a value equal to the given one, reading the file in place.
+// Parameters: a value to be searched.
+// Return value: a pointer into the mapping, or nullptr if the value is not found.
+template<class T, typename Comparator>
+const T* MappedBST<T,Comparator>::search(const T &value) const{
+    size_t k = FrozenBST<T, Comparator>::lowerBoundIndex(values, numValues, value, comparator);
+    // values[k] is not less than value, so it is equal if it is also <= value
+    if (k == 0 || !comparator(values[k], value)){
+        return nullptr;
+    }
+    return &values[k];
+}
+
+// Contains function.
+// Description: This function checks if a value equal to the given one is in the snapshot.
+// Parameters: a value to be searched.
+// Return value: true if the value is found, and false otherwise.
+template<class T, typename Comparator>
+bool MappedBST<T,Comparator>::contains(const T &value) const{
+    return search(value) != nullptr;
+}
+
+// Lower bound function.
+// Description: This function finds the smallest value that is not less than the given one.
+// Parameters: a value.
+// Return value: a pointer into the mapping, or nullptr if every value is less than the given one.
+template<class T, typename Comparator>
+const T* MappedBST<T,Comparator>::lower_bound(const T &value) const{
+    size_t k = FrozenBST<T, Comparator>::lowerBoundIndex(values, numValues, value, comparator);
+    return (k == 0) ? nullptr : &values[k];
+}
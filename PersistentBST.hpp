@@ -0,0 +1,186 @@
+/*
+File name: PersistentBST.hpp
+Creation Date: 10/16/2026
+Description: Header file for the PersistentBST<> templated class, a BST<> variant with O(1) copies
+*/
+
+#pragma once
+
+#include "DoublyLinkedList.hpp"
+#include "DoublyLinkedList.tpp"
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+/*
+PersistentBST is an AVL tree whose nodes are immutable and shared between copies. Copying a PersistentBST copies
+one reference-counted pointer to the root, so handing a consistent snapshot to a background job is O(1) no
+matter how large the tree is. insert and erase never modify a node: they build new copies of the O(log n) nodes
+on the path to the change and share every other subtree with the previous version, which stays valid and
+unchanged for everyone still holding it. Nodes are freed when the last version that references them goes away.
+
+Nodes have no parent pointers (a node can have many parents, one per version), so iterators keep the path from
+the root on a small stack. Separate copies may be used and destroyed from different threads; a single copy is
+not synchronized. The comparator follows the BST<> convention: comparator(a, b) is true if a <= b.
+
+Code that copies a BST<> to hand out snapshots can hold a PersistentBST instead: besides search, insert and
+erase, it has treeMin, treeMax and the three get*OrderTraversal functions of BST<>, which return values rather
+than nodes since nodes are shared. BST<>::snapshot() converts an existing tree once, in O(n).
+*/
+template<class T, typename Comparator = std::less_equal<T> >
+class PersistentBST {
+
+    private:
+    struct Node;
+    typedef std::shared_ptr<const Node> NodePtr;
+
+    struct Node {
+        T value;
+        NodePtr left, right;
+        int height;
+        size_t subtreeSize;
+
+        Node(const T &value, const NodePtr &left, const NodePtr &right);
+    };
+
+    NodePtr root;
+    Comparator comparator;
+
+    static int heightOf(const NodePtr &node);
+    static size_t sizeOf(const NodePtr &node);
+
+    // new node over left and right, rotating once or twice if their heights differ by 2
+    static NodePtr balance(const T &value, const NodePtr &left, const NodePtr &right);
+
+    // path-copying insert/erase; return the root of the new version of the subtree
+    NodePtr insertInto(const NodePtr &node, const T &value) const;
+    NodePtr eraseFrom(const NodePtr &node, const T &value, bool &erased) const;
+    static NodePtr eraseMin(const NodePtr &node, const Node *&min);
+
+    // perfectly balanced subtree over the next count values of a sorted range
+    template<class ForwardIt>
+    static NodePtr buildSubTree(ForwardIt &next, size_t count);
+
+    const Node* lowerBoundNode(const T &value) const;
+
+    // append the values of a subtree to list, in preorder and postorder
+    static void appendPreOrder(const Node *node, DoublyLinkedList<T> &list);
+    static void appendPostOrder(const Node *node, DoublyLinkedList<T> &list);
+
+
+    public:
+    // read-only forward iterator, in order; stays valid as long as the version it came from is alive
+    class iterator {
+        private:
+        std::vector<const Node*> path;
+
+        void pushLeftSpine(const Node *node);
+
+        friend class PersistentBST<T, Comparator>;
+
+        public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        iterator(void) {}
+
+        reference operator*(void) const { return path.back()->value; }
+        pointer operator->(void) const { return &path.back()->value; }
+        iterator& operator++(void);
+        iterator operator++(int) { iterator old = *this; ++*this; return old; }
+        bool operator==(const iterator &other) const { return path == other.path; }
+        bool operator!=(const iterator &other) const { return path != other.path; }
+    };
+    typedef iterator const_iterator;
+
+
+    // default constructor
+    PersistentBST(Comparator comparator = Comparator());
+
+
+    // sorted range constructor; [first, last) must already be in order
+    template<class ForwardIt>
+    PersistentBST(ForwardIt first, ForwardIt last, Comparator comparator = Comparator());
+
+
+    // copy constructor, assignment and destructor are O(1): versions share their nodes
+
+
+    // checks if is empty
+    bool empty(void) const;
+
+
+    // size
+    size_t size(void) const;
+
+
+    // height of the tree, 0 if empty
+    int height(void) const;
+
+
+    // insert; copies only the nodes on the path to the new value
+    void insert(const T &value);
+
+
+    // erase; removes one value equal to value, copying only the nodes on its path
+    // returns false if there is no such value
+    bool erase(const T &value);
+
+
+    // search
+    // returns a pointer to a value equal to value, or nullptr if there is none
+    const T* search(const T &value) const;
+
+
+    // contains
+    bool contains(const T &value) const;
+
+
+    // lower bound
+    // returns a pointer to the smallest value that is not less than value, or nullptr if there is none
+    const T* lower_bound(const T &value) const;
+
+
+    // min
+    // throws std::length_error if tree is empty
+    const T& treeMin(void) const;
+
+
+    // max
+    // throws std::length_error if tree is empty
+    const T& treeMax(void) const;
+
+
+    // preorder
+    // throws std::length_error if tree is empty
+    DoublyLinkedList<T> getPreOrderTraversal(void) const;
+
+
+    // inorder
+    // throws std::length_error if tree is empty
+    DoublyLinkedList<T> getInOrderTraversal(void) const;
+
+
+    // postorder
+    // throws std::length_error if tree is empty
+    DoublyLinkedList<T> getPostOrderTraversal(void) const;
+
+
+    // in-order visit; visit is called with each value, in order
+    template<class Visitor>
+    void visitInOrder(Visitor visit) const;
+
+
+    // checks if two versions are the same version (share their root), without comparing values
+    bool sharesRootWith(const PersistentBST<T, Comparator> &other) const;
+
+
+    // iterators, in order
+    iterator begin(void) const;
+    iterator end(void) const;
+};
@@ -0,0 +1,447 @@
+/*
+PersistentBST.tpp
+A file that contains the implementation of the PersistentBST class methods in the PersistentBST.hpp file.
+*/
+
+#pragma once
+
+#include "PersistentBST.hpp"
+#include <stdexcept>
+
+using namespace std;
+
+// Node constructor.
+// Description: This function constructs a node over two existing subtrees and computes its height and size.
+// Parameters: the value, the left and right subtrees.
+// Return value: NONE.
+template<class T, typename Comparator>
+PersistentBST<T,Comparator>::Node::Node(const T &value, const NodePtr &left, const NodePtr &right)
+    : value(value), left(left), right(right){
+    int leftHeight = heightOf(left);
+    int rightHeight = heightOf(right);
+    height = 1 + ((leftHeight > rightHeight) ? leftHeight : rightHeight);
+    subtreeSize = 1 + sizeOf(left) + sizeOf(right);
+}
+
+// Height function.
+// Description: This function returns the height of a subtree.
+// Parameters: the root of the subtree.
+// Return value: the height, 0 for an empty subtree.
+template<class T, typename Comparator>
+int PersistentBST<T,Comparator>::heightOf(const NodePtr &node){
+    return node ? node->height : 0;
+}
+
+// Size function.
+// Description: This function returns the number of values in a subtree.
+// Parameters: the root of the subtree.
+// Return value: the size, 0 for an empty subtree.
+template<class T, typename Comparator>
+size_t PersistentBST<T,Comparator>::sizeOf(const NodePtr &node){
+    return node ? node->subtreeSize : 0;
+}
+
+// Balance function.
+// Description: This function creates a node holding value over left and right. If their heights differ by two,
+// the new nodes are arranged as after a single or double AVL rotation instead; left and right themselves are
+// never modified, only their children are reused.
+// Parameters: the value, the left and right subtrees (AVL trees whose heights differ by at most two).
+// Return value: the root of the new subtree.
+template<class T, typename Comparator>
+typename PersistentBST<T,Comparator>::NodePtr PersistentBST<T,Comparator>::balance(const T &value, const NodePtr &left, const NodePtr &right){
+    int leftHeight = heightOf(left);
+    int rightHeight = heightOf(right);
+    if (leftHeight > rightHeight + 1){
+        if (heightOf(left->left) >= heightOf(left->right)){
+            return make_shared<const Node>(left->value, left->left, make_shared<const Node>(value, left->right, right));
+        }
+        const NodePtr &middle = left->right;
+        return make_shared<const Node>(middle->value, make_shared<const Node>(left->value, left->left, middle->left),
+                                       make_shared<const Node>(value, middle->right, right));
+    }
+    if (rightHeight > leftHeight + 1){
+        if (heightOf(right->right) >= heightOf(right->left)){
+            return make_shared<const Node>(right->value, make_shared<const Node>(value, left, right->left), right->right);
+        }
+        const NodePtr &middle = right->left;
+        return make_shared<const Node>(middle->value, make_shared<const Node>(value, left, middle->left),
+                                       make_shared<const Node>(right->value, middle->right, right->right));
+    }
+    return make_shared<const Node>(value, left, right);
+}
+
+// Default constructor.
+// Description: This function constructs an empty tree.
+// Parameters: the comparator.
+// Return value: NONE.
+template<class T, typename Comparator>
+PersistentBST<T,Comparator>::PersistentBST(Comparator comparator){
+    this->comparator = comparator;
+}
+
+// Sorted range constructor.
+// Description: This function builds a perfectly balanced tree from values that are already in order, in
+// linear time.
+// Parameters: the range of values, the comparator.
+// Return value: NONE.
+template<class T, typename Comparator>
+template<class ForwardIt>
+PersistentBST<T,Comparator>::PersistentBST(ForwardIt first, ForwardIt last, Comparator comparator){
+    this->comparator = comparator;
+    root = buildSubTree(first, distance(first, last));
+}
+
+// Build subtree function.
+// Description: This function builds a perfectly balanced subtree out of the next count values.
+// Parameters: an iterator to the next value, advanced past the values used; the number of values.
+// Return value: the root of the subtree.
+template<class T, typename Comparator>
+template<class ForwardIt>
+typename PersistentBST<T,Comparator>::NodePtr PersistentBST<T,Comparator>::buildSubTree(ForwardIt &next, size_t count){
+    if (count == 0){
+        return NodePtr();
+    }
+    size_t leftCount = (count - 1) / 2;
+    NodePtr left = buildSubTree(next, leftCount);
+    const T &value = *next;
+    ++next;
+    NodePtr right = buildSubTree(next, count - 1 - leftCount);
+    return make_shared<const Node>(value, left, right);
+}
+
+// Checks if is empty.
+// Description: This function checks if the tree is empty.
+// Parameters: NONE.
+// Return value: true if the tree is empty, and false otherwise.
+template<class T, typename Comparator>
+bool PersistentBST<T,Comparator>::empty(void) const{
+    return !root;
+}
+
+// Size.
+// Description: This function returns the number of values in the tree.
+// Parameters: NONE.
+// Return value: the number of values.
+template<class T, typename Comparator>
+size_t PersistentBST<T,Comparator>::size(void) const{
+    return sizeOf(root);
+}
+
+// Height.
+// Description: This function returns the height of the tree.
+// Parameters: NONE.
+// Return value: the height, 0 if the tree is empty.
+template<class T, typename Comparator>
+int PersistentBST<T,Comparator>::height(void) const{
+    return heightOf(root);
+}
+
+// Insert into function.
+// Description: This function returns a new version of a subtree with value added, equal values going to the left
+// as in BST<>::insert.
+// Parameters: the root of the subtree, a value to be inserted.
+// Return value: the root of the new version.
+template<class T, typename Comparator>
+typename PersistentBST<T,Comparator>::NodePtr PersistentBST<T,Comparator>::insertInto(const NodePtr &node, const T &value) const{
+    if (!node){
+        return make_shared<const Node>(value, NodePtr(), NodePtr());
+    }
+    if (comparator(value, node->value)){
+        return balance(node->value, insertInto(node->left, value), node->right);
+    }
+    return balance(node->value, node->left, insertInto(node->right, value));
+}
+
+// Insert function.
+// Description: This function adds a value to this version of the tree; other copies are unaffected.
+// Parameters: a value to be inserted.
+// Return value: NONE.
+template<class T, typename Comparator>
+void PersistentBST<T,Comparator>::insert(const T &value){
+    root = insertInto(root, value);
+}
+
+// Erase min function.
+// Description: This function returns a new version of a subtree without its minimum.
+// Parameters: the root of a non-empty subtree, set to the node holding the minimum.
+// Return value: the root of the new version.
+template<class T, typename Comparator>
+typename PersistentBST<T,Comparator>::NodePtr PersistentBST<T,Comparator>::eraseMin(const NodePtr &node, const Node *&min){
+    if (!node->left){
+        min = node.get();
+        return node->right;
+    }
+    return balance(node->value, eraseMin(node->left, min), node->right);
+}
+
+// Erase from function.
+// Description: This function returns a new version of a subtree without one value equal to the given one.
+// Parameters: the root of the subtree, a value to be erased, set to true if a value was found.
+// Return value: the root of the new version, or node itself if there is no such value.
+template<class T, typename Comparator>
+typename PersistentBST<T,Comparator>::NodePtr PersistentBST<T,Comparator>::eraseFrom(const NodePtr &node, const T &value, bool &erased) const{
+    if (!node){
+        return node;
+    }
+    if (!comparator(node->value, value)){
+        NodePtr left = eraseFrom(node->left, value, erased);
+        return erased ? balance(node->value, left, node->right) : node;
+    }
+    if (!comparator(value, node->value)){
+        NodePtr right = eraseFrom(node->right, value, erased);
+        return erased ? balance(node->value, node->left, right) : node;
+    }
+    erased = true;
+    if (!node->left){
+        return node->right;
+    }
+    if (!node->right){
+        return node->left;
+    }
+    // The successor's node stays alive through node->right while its value is copied.
+    const Node *successor = nullptr;
+    NodePtr right = eraseMin(node->right, successor);
+    return balance(successor->value, node->left, right);
+}
+
+// Erase function.
+// Description: This function removes one value equal to the given one from this version of the tree; other
+// copies are unaffected.
+// Parameters: a value to be erased.
+// Return value: true if a value was erased, false if there was none.
+template<class T, typename Comparator>
+bool PersistentBST<T,Comparator>::erase(const T &value){
+    bool erased = false;
+    root = eraseFrom(root, value, erased);
+    return erased;
+}
+
+// Lower bound node function.
+// Description: This function descends from the root, remembering the last node where it turned left.
+// Parameters: a value.
+// Return value: the first node not less than value, or nullptr if there is none.
+template<class T, typename Comparator>
+const typename PersistentBST<T,Comparator>::Node* PersistentBST<T,Comparator>::lowerBoundNode(const T &value) const{
+    const Node *candidate = nullptr;
+    const Node *current = root.get();
+    while (current != nullptr){
+        if (comparator(value, current->value)){
+            candidate = current;
+            current = current->left.get();
+        }
+        else{
+            current = current->right.get();
+        }
+    }
+    return candidate;
+}
+
+// Search function.
+// Description: This function looks for a value equal to the given one.
+// Parameters: a value to be searched.
+// Return value: a pointer to the value found, or nullptr if there is none.
+template<class T, typename Comparator>
+const T* PersistentBST<T,Comparator>::search(const T &value) const{
+    const Node *candidate = lowerBoundNode(value);
+    if (candidate != nullptr && comparator(candidate->value, value)){
+        return &candidate->value;
+    }
+    return nullptr;
+}
+
+// Contains function.
+// Description: This function checks for a value equal to the given one.
+// Parameters: a value to be searched.
+// Return value: true if the value is found, and false otherwise.
+template<class T, typename Comparator>
+bool PersistentBST<T,Comparator>::contains(const T &value) const{
+    return search(value) != nullptr;
+}
+
+// Lower bound function.
+// Description: This function finds the smallest value not less than the given one.
+// Parameters: a value.
+// Return value: a pointer to the lower bound, or nullptr if every value is less than the given one.
+template<class T, typename Comparator>
+const T* PersistentBST<T,Comparator>::lower_bound(const T &value) const{
+    const Node *candidate = lowerBoundNode(value);
+    return (candidate != nullptr) ? &candidate->value : nullptr;
+}
+
+// Min function.
+// Description: This function follows the left children from the root.
+// Parameters: NONE.
+// Return value: the minimum value.
+// throws std::length_error if tree is empty.
+template<class T, typename Comparator>
+const T& PersistentBST<T,Comparator>::treeMin(void) const{
+    if (root == nullptr){
+        throw length_error("Tree is empty!");
+    }
+    const Node *node = root.get();
+    while (node->left != nullptr){
+        node = node->left.get();
+    }
+    return node->value;
+}
+
+// Max function.
+// Description: This function follows the right children from the root.
+// Parameters: NONE.
+// Return value: the maximum value.
+// throws std::length_error if tree is empty.
+template<class T, typename Comparator>
+const T& PersistentBST<T,Comparator>::treeMax(void) const{
+    if (root == nullptr){
+        throw length_error("Tree is empty!");
+    }
+    const Node *node = root.get();
+    while (node->right != nullptr){
+        node = node->right.get();
+    }
+    return node->value;
+}
+
+// Append preorder function.
+// Description: This function appends a node, then its left and right subtrees, to a list. The tree is an AVL
+// tree, so the recursion is O(log n) deep.
+// Parameters: the root of the subtree, the list.
+// Return value: NONE.
+template<class T, typename Comparator>
+void PersistentBST<T,Comparator>::appendPreOrder(const Node *node, DoublyLinkedList<T> &list){
+    if (node == nullptr){
+        return;
+    }
+    list.push_back(node->value);
+    appendPreOrder(node->left.get(), list);
+    appendPreOrder(node->right.get(), list);
+}
+
+// Append postorder function.
+// Description: This function appends the left and right subtrees of a node, then the node, to a list.
+// Parameters: the root of the subtree, the list.
+// Return value: NONE.
+template<class T, typename Comparator>
+void PersistentBST<T,Comparator>::appendPostOrder(const Node *node, DoublyLinkedList<T> &list){
+    if (node == nullptr){
+        return;
+    }
+    appendPostOrder(node->left.get(), list);
+    appendPostOrder(node->right.get(), list);
+    list.push_back(node->value);
+}
+
+// Preorder traversal.
+// Description: This function returns the values in preorder.
+// Parameters: NONE.
+// Return value: a DoublyLinkedList of the values in preorder.
+// throws std::length_error if tree is empty.
+template<class T, typename Comparator>
+DoublyLinkedList<T> PersistentBST<T,Comparator>::getPreOrderTraversal(void) const{
+    if (root == nullptr){
+        throw length_error("Tree is empty!");
+    }
+    DoublyLinkedList<T> list;
+    appendPreOrder(root.get(), list);
+    return list;
+}
+
+// Inorder traversal.
+// Description: This function returns the values in order.
+// Parameters: NONE.
+// Return value: a DoublyLinkedList of the values in inorder.
+// throws std::length_error if tree is empty.
+template<class T, typename Comparator>
+DoublyLinkedList<T> PersistentBST<T,Comparator>::getInOrderTraversal(void) const{
+    if (root == nullptr){
+        throw length_error("Tree is empty!");
+    }
+    DoublyLinkedList<T> list;
+    for (iterator it = begin(); it != end(); ++it){
+        list.push_back(*it);
+    }
+    return list;
+}
+
+// Postorder traversal.
+// Description: This function returns the values in postorder.
+// Parameters: NONE.
+// Return value: a DoublyLinkedList of the values in postorder.
+// throws std::length_error if tree is empty.
+template<class T, typename Comparator>
+DoublyLinkedList<T> PersistentBST<T,Comparator>::getPostOrderTraversal(void) const{
+    if (root == nullptr){
+        throw length_error("Tree is empty!");
+    }
+    DoublyLinkedList<T> list;
+    appendPostOrder(root.get(), list);
+    return list;
+}
+
+// Visit in-order function.
+// Description: This function calls visit on every value in order.
+// Parameters: the visitor.
+// Return value: NONE.
+template<class T, typename Comparator>
+template<class Visitor>
+void PersistentBST<T,Comparator>::visitInOrder(Visitor visit) const{
+    for (iterator it = begin(); it != end(); ++it){
+        visit(*it);
+    }
+}
+
+// Shares root with function.
+// Description: This function checks if two trees are the same version, i.e. neither was modified since one was
+// copied from the other.
+// Parameters: the other tree.
+// Return value: true if both share their root, and false otherwise.
+template<class T, typename Comparator>
+bool PersistentBST<T,Comparator>::sharesRootWith(const PersistentBST<T,Comparator> &other) const{
+    return root == other.root;
+}
+
+// Push left spine function.
+// Description: This function pushes a node and its chain of left children onto the iterator's path.
+// Parameters: the node.
+// Return value: NONE.
+template<class T, typename Comparator>
+void PersistentBST<T,Comparator>::iterator::pushLeftSpine(const Node *node){
+    while (node != nullptr){
+        path.push_back(node);
+        node = node->left.get();
+    }
+}
+
+// Increment operator.
+// Description: This function moves the iterator to the in-order successor: the leftmost node of the right
+// subtree, or else the nearest ancestor whose left subtree was just finished.
+// Parameters: NONE.
+// Return value: the iterator.
+template<class T, typename Comparator>
+typename PersistentBST<T,Comparator>::iterator& PersistentBST<T,Comparator>::iterator::operator++(void){
+    const Node *node = path.back();
+    path.pop_back();
+    pushLeftSpine(node->right.get());
+    return *this;
+}
+
+// Begin.
+// Description: This function returns an iterator to the minimum of the tree.
+// Parameters: NONE.
+// Return value: an iterator to the minimum, or end() if the tree is empty.
+template<class T, typename Comparator>
+typename PersistentBST<T,Comparator>::iterator PersistentBST<T,Comparator>::begin(void) const{
+    iterator it;
+    it.path.reserve(heightOf(root));
+    it.pushLeftSpine(root.get());
+    return it;
+}
+
+// End.
+// Description: This function returns the past-the-end iterator.
+// Parameters: NONE.
+// Return value: an iterator with an empty path.
+template<class T, typename Comparator>
+typename PersistentBST<T,Comparator>::iterator PersistentBST<T,Comparator>::end(void) const{
+    return iterator();
+}
@@ -0,0 +1,191 @@
+/*
+File name: PoolAllocator.hpp
+Creation Date: 10/16/2026
+Description: Header file for the NodePool class and the PoolAllocator<> templated allocator
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <type_traits>
+
+/*
+NodePool hands out fixed-size slots carved from large contiguous blocks. Freed slots go on a free list and are
+reused by the next allocation, and all blocks are returned to the system at once when the pool is destroyed.
+The slot size is fixed by the first allocation; requests of any other size or alignment are passed through to
+::operator new. A pool is not thread-safe.
+*/
+class NodePool {
+    private:
+    // a free slot stores the link to the next free slot
+    struct FreeSlot {
+        FreeSlot *next;
+    };
+
+    // Owner of the blocks. When a pool adopts another one, their stores are merged: the blocks move to one store
+    // and the other store forwards to it, keeping it alive for as long as any pool still refers to either.
+    struct BlockStore {
+        std::vector<void*> blocks;
+        std::shared_ptr<BlockStore> forward;
+        ~BlockStore(void);
+    };
+
+    // size and alignment of the objects served from slots, 0 until the first allocation
+    size_t objectSize;
+    size_t objectAlignment;
+    // size of one slot in bytes
+    size_t slotSize;
+    // head of the list of freed slots
+    FreeSlot *freeList;
+    // unused part of the most recent block
+    char *blockCursor;
+    char *blockEnd;
+    // number of slots in the next block; blocks grow geometrically up to maxBlockSlots
+    size_t nextBlockSlots;
+    std::shared_ptr<BlockStore> store;
+
+    static const size_t firstBlockSlots = 32;
+    static const size_t maxBlockSlots = 4096;
+
+    public:
+    /*
+    Description:
+        - Default constructor for NodePool; no memory is reserved until the first allocation
+    Parameters: None
+    Return: None
+    Exceptions: None
+    */
+    NodePool(void);
+
+
+    NodePool(const NodePool &pool) = delete;
+    NodePool& operator=(const NodePool &pool) = delete;
+
+
+    /*
+    Description:
+        - Returns uninitialized memory for one object
+    Parameters:
+        - size_t bytes: the size of the object
+        - size_t alignment: the alignment of the object
+    Return:
+        - A pointer to the memory
+    Exceptions:
+        - std::bad_alloc if memory cannot be obtained
+    */
+    void* allocate(size_t bytes, size_t alignment);
+
+
+    /*
+    Description:
+        - Gives back memory obtained from allocate with the same size and alignment
+    Parameters:
+        - void *pointer: the memory to give back
+        - size_t bytes: the size passed to allocate
+        - size_t alignment: the alignment passed to allocate
+    Return: None
+    Exceptions: None
+    */
+    void deallocate(void *pointer, size_t bytes, size_t alignment);
+
+
+    /*
+    Description:
+        - Merges the blocks of another pool into this pool's store, so that slots allocated by either pool can
+          be freed into the other and stay valid until both pools are gone
+    Parameters:
+        - NodePool &other: the pool to merge with
+    Return: None
+    Exceptions: None
+    */
+    void adopt(NodePool &other);
+
+
+    /*
+    Description:
+        - Checks whether the blocks of this pool are shared with another pool
+    Parameters: None
+    Return:
+        - `true` if no other pool shares the blocks, so destroying the pool frees all of them
+    Exceptions: None
+    */
+    bool ownsBlocks(void) const;
+
+
+    private:
+    // whether a request of this size and alignment is served from the slots
+    bool usesSlots(size_t bytes, size_t alignment) const;
+    // reserves a new block and points the cursor at it
+    void grow(void);
+    // the store that currently holds the blocks, following forwards
+    static BlockStore* findStore(BlockStore *store);
+};
+
+
+/*
+PoolAllocator<T> is a standard allocator backed by a NodePool. Copies of an allocator, including copies rebound
+to another type, share the same pool, while a default-constructed allocator starts a new pool. Containers in this
+project default to it, so each container gets its own pool and its nodes end up next to each other in memory.
+*/
+template<class T>
+class PoolAllocator {
+    private:
+    std::shared_ptr<NodePool> pool;
+
+    template<class U>
+    friend class PoolAllocator;
+
+    public:
+    typedef T value_type;
+    typedef std::false_type is_always_equal;
+
+
+    // default constructor; creates a new pool
+    PoolAllocator(void);
+
+
+    // converting constructor; shares the pool of other
+    template<class U>
+    PoolAllocator(const PoolAllocator<U> &other);
+
+
+    // allocate; memory for n objects of type T
+    // throws std::bad_array_new_length if n exceeds max_size()
+    T* allocate(size_t n);
+
+
+    // deallocate; gives back memory obtained from allocate(n)
+    void deallocate(T *pointer, size_t n);
+
+
+    // max_size; the largest n that allocate accepts
+    size_t max_size(void) const;
+
+
+    // adopt; lets this allocator and other free memory that was allocated by either of them
+    template<class U>
+    void adopt(const PoolAllocator<U> &other);
+
+
+    // uniquePool; true if no other allocator or pool shares this pool's memory, so dropping it releases every
+    // node at once
+    bool uniquePool(void) const;
+
+
+    template<class U>
+    bool operator==(const PoolAllocator<U> &rhs) const;
+
+
+    template<class U>
+    bool operator!=(const PoolAllocator<U> &rhs) const;
+};
+
+
+// IsPoolAllocator<A>::value is true if A is a PoolAllocator<>
+template<class Allocator>
+struct IsPoolAllocator : std::false_type {};
+
+template<class T>
+struct IsPoolAllocator<PoolAllocator<T> > : std::true_type {};
@@ -0,0 +1,238 @@
+/*
+PoolAllocator.tpp
+A file that contains the implementation of the NodePool and PoolAllocator classes in the PoolAllocator.hpp file.
+*/
+
+#pragma once
+
+#include <new>
+#include "PoolAllocator.hpp"
+
+using namespace std;
+
+// Block store destructor. Releases every block; objects still living in them are not destroyed.
+// Parameter: NONE.
+// Return value: NONE.
+inline NodePool::BlockStore::~BlockStore(void) {
+    for (size_t i = 0; i < blocks.size(); i++) {
+        ::operator delete(blocks[i]);
+    }
+}
+
+// Default constructor.
+// Parameter: NONE.
+// Return value: NONE.
+inline NodePool::NodePool(void) {
+    objectSize = 0;
+    objectAlignment = 0;
+    slotSize = 0;
+    freeList = nullptr;
+    blockCursor = nullptr;
+    blockEnd = nullptr;
+    nextBlockSlots = firstBlockSlots;
+    store = make_shared<BlockStore>();
+}
+
+// Find store. Follows the forwards left by merges.
+// Parameter: A store.
+// Return value: The store that holds the blocks.
+inline NodePool::BlockStore* NodePool::findStore(BlockStore *store) {
+    while (store->forward != nullptr) {
+        store = store->forward.get();
+    }
+    return store;
+}
+
+// Uses slots.
+// Parameter: The size and alignment of a request.
+// Return value: True if the request is served from the slots of this pool.
+inline bool NodePool::usesSlots(size_t bytes, size_t alignment) const {
+    if (alignment > alignof(max_align_t)) {
+        return false;
+    }
+    return objectSize == 0 || (bytes == objectSize && alignment == objectAlignment);
+}
+
+// Grow. Reserves a block twice as large as the previous one, up to maxBlockSlots slots.
+// Parameter: NONE.
+// Return value: NONE.
+inline void NodePool::grow(void) {
+    char *block = static_cast<char*>(::operator new(slotSize * nextBlockSlots));
+    findStore(store.get())->blocks.push_back(block);
+    blockCursor = block;
+    blockEnd = block + slotSize * nextBlockSlots;
+    if (nextBlockSlots < maxBlockSlots) {
+        nextBlockSlots *= 2;
+    }
+}
+
+// Allocate. Takes a slot from the free list, or the next unused slot of the current block.
+// Parameter: The size and alignment of the object.
+// Return value: A pointer to uninitialized memory.
+inline void* NodePool::allocate(size_t bytes, size_t alignment) {
+    if (!usesSlots(bytes, alignment)) {
+        if (alignment > alignof(max_align_t)) {
+            return ::operator new(bytes, align_val_t(alignment));
+        }
+        return ::operator new(bytes);
+    }
+    if (objectSize == 0) {
+        // The first request fixes the slot size: large enough for a free-list link, rounded to the alignment.
+        objectSize = bytes;
+        objectAlignment = alignment;
+        size_t size = (bytes < sizeof(FreeSlot)) ? sizeof(FreeSlot) : bytes;
+        size_t align = (alignment < alignof(FreeSlot)) ? alignof(FreeSlot) : alignment;
+        slotSize = ((size + align - 1) / align) * align;
+    }
+    if (freeList != nullptr) {
+        FreeSlot *slot = freeList;
+        freeList = slot->next;
+        return slot;
+    }
+    if (blockCursor == blockEnd) {
+        grow();
+    }
+    void *slot = blockCursor;
+    blockCursor += slotSize;
+    return slot;
+}
+
+// Deallocate. Pushes the slot on the free list.
+// Parameter: The memory and the size and alignment it was allocated with.
+// Return value: NONE.
+inline void NodePool::deallocate(void *pointer, size_t bytes, size_t alignment) {
+    if (pointer == nullptr) {
+        return;
+    }
+    if (objectSize == 0 || !usesSlots(bytes, alignment)) {
+        if (alignment > alignof(max_align_t)) {
+            ::operator delete(pointer, align_val_t(alignment));
+        } else {
+            ::operator delete(pointer);
+        }
+        return;
+    }
+    FreeSlot *slot = static_cast<FreeSlot*>(pointer);
+    slot->next = freeList;
+    freeList = slot;
+}
+
+// Adopt. Merges the block stores of both pools.
+// Parameter: The pool to merge with.
+// Return value: NONE.
+inline void NodePool::adopt(NodePool &other) {
+    if (objectSize == 0) {
+        // Slots freed here will come from other, so use its slot layout.
+        objectSize = other.objectSize;
+        objectAlignment = other.objectAlignment;
+        slotSize = other.slotSize;
+    }
+    BlockStore *mine = findStore(store.get());
+    BlockStore *theirs = findStore(other.store.get());
+    if (mine == theirs) {
+        return;
+    }
+    mine->blocks.insert(mine->blocks.end(), theirs->blocks.begin(), theirs->blocks.end());
+    theirs->blocks.clear();
+    // The forward keeps the merged store alive for every pool that still points at the old one.
+    theirs->forward = (mine == store.get()) ? store : shared_ptr<BlockStore>(store, mine);
+}
+
+// Owns blocks.
+// Parameter: NONE.
+// Return value: True if no other pool shares the blocks of this pool.
+inline bool NodePool::ownsBlocks(void) const {
+    return store->forward == nullptr && store.use_count() == 1;
+}
+
+// Default constructor. Starts a new pool.
+// Parameter: NONE.
+// Return value: NONE.
+template <class T>
+PoolAllocator<T>::PoolAllocator(void) : pool(make_shared<NodePool>()) {}
+
+// Converting constructor. Shares the pool of another allocator.
+// Parameter: The allocator whose pool is shared.
+// Return value: NONE.
+template <class T>
+template <class U>
+PoolAllocator<T>::PoolAllocator(const PoolAllocator<U> &other) : pool(other.pool) {}
+
+// Allocate. Single objects come from the pool; arrays go to ::operator new, aligned for T.
+// Parameter: The number of objects.
+// Return value: A pointer to uninitialized memory for n objects.
+// Throws std::bad_array_new_length if n * sizeof(T) would overflow.
+template <class T>
+T* PoolAllocator<T>::allocate(size_t n) {
+    if (n != 1) {
+        if (n > max_size()) {
+            throw bad_array_new_length();
+        }
+        if constexpr (alignof(T) > alignof(max_align_t)) {
+            return static_cast<T*>(::operator new(n * sizeof(T), align_val_t(alignof(T))));
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    return static_cast<T*>(pool->allocate(sizeof(T), alignof(T)));
+}
+
+// Deallocate.
+// Parameter: The memory and the number of objects it was allocated for.
+// Return value: NONE.
+template <class T>
+void PoolAllocator<T>::deallocate(T *pointer, size_t n) {
+    if (n != 1) {
+        if constexpr (alignof(T) > alignof(max_align_t)) {
+            ::operator delete(pointer, align_val_t(alignof(T)));
+            return;
+        }
+        ::operator delete(pointer);
+        return;
+    }
+    pool->deallocate(pointer, sizeof(T), alignof(T));
+}
+
+// Max size.
+// Parameter: NONE.
+// Return value: The largest number of objects allocate accepts.
+template <class T>
+size_t PoolAllocator<T>::max_size(void) const {
+    return static_cast<size_t>(-1) / sizeof(T);
+}
+
+// Adopt. After this call, memory allocated by other may be deallocated through this allocator.
+// Parameter: The allocator whose pool is adopted.
+// Return value: NONE.
+template <class T>
+template <class U>
+void PoolAllocator<T>::adopt(const PoolAllocator<U> &other) {
+    if (pool != other.pool) {
+        pool->adopt(*other.pool);
+    }
+}
+
+// Unique pool.
+// Parameter: NONE.
+// Return value: True if this allocator is the only one using its pool.
+template <class T>
+bool PoolAllocator<T>::uniquePool(void) const {
+    return pool.use_count() == 1 && pool->ownsBlocks();
+}
+
+// Equality operator. Two allocators are equal if they share a pool.
+// Parameter: The allocator to compare with.
+// Return value: True if both allocators use the same pool.
+template <class T>
+template <class U>
+bool PoolAllocator<T>::operator==(const PoolAllocator<U> &rhs) const {
+    return pool == rhs.pool;
+}
+
+// Inequality operator.
+// Parameter: The allocator to compare with.
+// Return value: True if the allocators use different pools.
+template <class T>
+template <class U>
+bool PoolAllocator<T>::operator!=(const PoolAllocator<U> &rhs) const {
+    return pool != rhs.pool;
+}
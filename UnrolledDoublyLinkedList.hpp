@@ -0,0 +1,603 @@
+/*
+File name: UnrolledDoublyLinkedList.hpp
+Creation Date: 10/16/2026
+Description: Header file for the UnrolledDoublyLinkedList<> templated class, a DoublyLinkedList<> that keeps
+several elements per node
+*/
+
+
+/*
+ABOUT THIS FILE:
+- This file contains the class definition for UnrolledDoublyLinkedList<T>, which has the public interface of
+  DoublyLinkedList<T>.
+- DoublyLinkedList<T> allocates one node per element, so a scan follows one pointer, and usually misses the cache,
+  per element. Here every node (a chunk) holds up to `elementsPerChunk` elements side by side in about ChunkBytes
+  bytes (256 by default, four cache lines): a scan reads whole chunks, and finding an index steps over a chunk at
+  a time.
+- Positional operations walk from whichever of the head, the tail and a cursor (the chunk last reached by index)
+  is nearest, so accessing the indices in order, or editing around one position, costs a step each.
+- Inserting into a full chunk splits it in half; a chunk that falls below half full after an erase takes in the
+  elements of the next one if they fit, so chunks stay at least about half full.
+- Iterators and references are invalidated by any insertion or removal, since elements move within and between
+  chunks; only push_back and emplace_back keep references to the existing elements valid.
+*/
+
+#pragma once
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <iterator>
+#include <cstddef>
+#include "PoolAllocator.hpp"
+#include "PoolAllocator.tpp"
+
+
+// The optional second template parameter is the allocator used for the chunks, as in DoublyLinkedList<>; the third
+// is the approximate size of a chunk in bytes.
+template<class T, class Allocator = PoolAllocator<T>, size_t ChunkBytes = 256>
+class UnrolledDoublyLinkedList{
+
+    private:
+    static constexpr size_t chunkHeader = 2 * sizeof(void*) + sizeof(size_t);
+    static constexpr size_t chunkFit = (ChunkBytes > chunkHeader) ? (ChunkBytes - chunkHeader) / sizeof(T) : 0;
+    static constexpr size_t chunkCapacity = (chunkFit > 4) ? chunkFit : 4;
+
+    // Private struct for the chunks of the list
+    struct Chunk{
+        // Pointer the chunk preceding the current chunk
+        Chunk *prev;
+        // Pointer to the chunk following the current chunk
+        Chunk *next;
+        // Number of elements in the chunk, from 1 to chunkCapacity
+        size_t count;
+        // The elements, values()[0..count), constructed as needed
+        alignas(T) unsigned char storage[chunkCapacity * sizeof(T)];
+
+        T* values(void) { return reinterpret_cast<T*>(storage); }
+        const T* values(void) const { return reinterpret_cast<const T*>(storage); }
+    };
+
+    // Pointer to the head chunk
+    Chunk* head;
+    // Pointer to the tail chunk
+    Chunk* tail;
+    // Member keeping track of the number of elements in the list
+    size_t numElements;
+    // The chunk last reached by index, or nullptr, and the index of its first element
+    Chunk* cursor;
+    size_t cursorStart;
+
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Chunk> ChunkAllocator;
+    typedef std::allocator_traits<ChunkAllocator> ChunkAllocatorTraits;
+    // Allocator for the chunks
+    ChunkAllocator allocator;
+
+    /*
+    Description:
+        - Allocates an empty chunk from the allocator
+    Parameters: None
+    Return: a pointer to a new chunk with no elements and null links
+    Exceptions: None
+    */
+    Chunk* createChunk(void);
+
+    /*
+    Description:
+        - Destroys the elements of a chunk and returns its memory to the allocator
+    Parameters:
+        - Chunk *chunk: the chunk to destroy
+    Return: None
+    Exceptions: None
+    */
+    void destroyChunk(Chunk *chunk);
+
+    /*
+    Description:
+        - Destroys every chunk of the list and leaves it empty
+    Parameters: None
+    Return: None
+    Exceptions: None
+    */
+    void destroyChunks(void);
+
+    /*
+    Description:
+        - Links a chunk into the list after `before`, or at the front if `before` is nullptr
+    Parameters:
+        - Chunk *chunk: the chunk to link
+        - Chunk *before: the chunk it follows
+    Return: None
+    Exceptions: None
+    */
+    void linkChunk(Chunk *chunk, Chunk *before);
+
+    /*
+    Description:
+        - Unlinks a chunk from the list and destroys it; the cursor is cleared if it was on the chunk
+    Parameters:
+        - Chunk *chunk: the chunk to remove
+    Return: None
+    Exceptions: None
+    */
+    void removeChunk(Chunk *chunk);
+
+    /*
+    Description:
+        - Moves the elements of a chunk from position `offset` on into a new chunk linked right after it
+    Parameters:
+        - Chunk *chunk: the chunk to split
+        - size_t offset: the position of the first element to move
+    Return: the new chunk
+    Exceptions: None
+    */
+    Chunk* splitChunk(Chunk *chunk, size_t offset);
+
+    /*
+    Description:
+        - Constructs an element at position `offset` of a chunk that is not full, shifting the later elements right
+    Parameters:
+        - Chunk *chunk: the chunk
+        - size_t offset: the position of the new element, at most the number of elements in the chunk
+        - Args&&... args: the arguments forwarded to the constructor of T
+    Return: a reference to the new element
+    Exceptions: None
+    */
+    template<class... Args>
+    T& emplaceAt(Chunk *chunk, size_t offset, Args&&... args);
+
+    /*
+    Description:
+        - Constructs an element at position `index` of the list, which must be at most its size; a full chunk is
+          split in half first
+    Parameters:
+        - size_t index: the index of the new element
+        - Args&&... args: the arguments forwarded to the constructor of T
+    Return: None
+    Exceptions: None
+    */
+    template<class... Args>
+    void emplaceIndex(size_t index, Args&&... args);
+
+    /*
+    Description:
+        - Destroys the element at position `offset` of a chunk, shifting the later elements left
+    Parameters:
+        - Chunk *chunk: the chunk
+        - size_t offset: the position of the element
+    Return: None
+    Exceptions: None
+    */
+    void eraseAt(Chunk *chunk, size_t offset);
+
+    /*
+    Description:
+        - Prepares the list to take over the chunks of `list`; pooled allocators merge their pools so that either
+          list can free the other's chunks
+    Parameters:
+        - UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &list: the list whose chunks will be linked into this one
+    Return:
+        - `true` if the chunks can be relinked, `false` if the elements must be moved one by one
+    Exceptions: None
+    */
+    bool canAdoptChunks(UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &list);
+
+    /*
+    Description:
+        - Finds the chunk holding the element at the specified index, walking from whichever of the head, the tail
+          and the cursor is nearest, and moves the cursor there
+    Parameters:
+        - size_t index: the specified index as (unsigned)
+        - size_t &offset: set to the position of the element within the chunk
+    Return: a pointer to the chunk
+    Exceptions:
+        - std::out_of_range if the index is not less than the number of elements in the list
+    */
+    Chunk* getChunk(size_t index, size_t &offset);
+
+
+    public:
+
+    /*
+    Description:
+        - Bidirectional iterator over the elements, from head to tail; `Value` is T for iterator and const T for const_iterator
+    */
+    template<class Value>
+    class BasicIterator {
+        private:
+        Chunk *chunk;
+        // position of the element within chunk
+        size_t offset;
+        const UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> *list;
+
+        public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Value* pointer;
+        typedef Value& reference;
+
+        BasicIterator(void) : chunk(nullptr), offset(0), list(nullptr) {}
+        BasicIterator(Chunk *chunk, size_t offset, const UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> *list) : chunk(chunk), offset(offset), list(list) {}
+        // an iterator converts to a const_iterator
+        operator BasicIterator<const T>(void) const { return BasicIterator<const T>(chunk, offset, list); }
+
+        reference operator*(void) const { return chunk->values()[offset]; }
+        pointer operator->(void) const { return &chunk->values()[offset]; }
+
+        BasicIterator& operator++(void) {
+            if (++offset == chunk->count) {
+                chunk = chunk->next;
+                offset = 0;
+            }
+            return *this;
+        }
+        BasicIterator operator++(int) { BasicIterator old = *this; ++(*this); return old; }
+        // decrementing end() yields the tail
+        BasicIterator& operator--(void) {
+            if (chunk != nullptr && offset > 0) {
+                offset--;
+                return *this;
+            }
+            chunk = (chunk == nullptr) ? list->tail : chunk->prev;
+            offset = chunk->count - 1;
+            return *this;
+        }
+        BasicIterator operator--(int) { BasicIterator old = *this; --(*this); return old; }
+
+        bool operator==(const BasicIterator &rhs) const { return chunk == rhs.chunk && offset == rhs.offset; }
+        bool operator!=(const BasicIterator &rhs) const { return !(*this == rhs); }
+    };
+    typedef BasicIterator<T> iterator;
+    typedef BasicIterator<const T> const_iterator;
+
+
+    // the number of elements a full chunk holds
+    static constexpr size_t elementsPerChunk = chunkCapacity;
+
+
+    /*
+    Description:
+        - Default Constructor for UnrolledDoublyLinkedList<T>
+    Parameters: None
+    Return: None
+    Exceptions: None
+    */
+    UnrolledDoublyLinkedList(void);
+
+
+    /*
+    Description:
+        - Constructor for UnrolledDoublyLinkedList<T> using the given allocator for its chunks
+    Parameters:
+        - const Allocator &allocator: the allocator, e.g. a copy of another list's allocator to share its pool
+    Return: None
+    Exceptions: None
+    */
+    explicit UnrolledDoublyLinkedList(const Allocator &allocator);
+
+
+    /*
+    Description:
+        - Copy Constructor for UnrolledDoublyLinkedList<T>; copies the elements into full chunks
+    Parameters:
+        - UnrolledDoublyLinkedList<T> list: list to copy
+    Return: None
+    Exceptions: None
+    */
+    UnrolledDoublyLinkedList(const UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>& list);
+
+
+    /*
+    Description:
+        - Move Constructor for UnrolledDoublyLinkedList<T>; takes over the chunks of `list` and its allocator without
+          copying them. `list` gets a new allocator (with PoolAllocator, a pool of its own), so it can be reused on
+          another thread, and this list's pool stays unshared.
+    Parameters:
+        - UnrolledDoublyLinkedList<T> &&list: list to move from; it is left empty and still usable
+    Return: None
+    Exceptions: None
+    */
+    UnrolledDoublyLinkedList(UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>&& list) noexcept;
+
+
+    /*
+    Description:
+        - Assignment Operator for UnrolledDoublyLinkedList<T>
+    Parameters:
+        - UnrolledDoublyLinkedList<T> rhs: list to assign, already copied (or moved) by the caller
+    Return: None
+    Exceptions: None
+    Note:
+        - The chunks of `rhs` are swapped in, so assigning from an rvalue uses the move constructor and copies nothing.
+    */
+    UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>& operator=(UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> rhs);
+
+
+    /*
+    Description:
+        - Destructor for UnrolledDoublyLinkedList<T>
+    Parameters: None
+    Return: None
+    Exceptions: None
+    */
+    ~UnrolledDoublyLinkedList(void);
+
+
+    /*
+    Description:
+        - Inserts `item` at position `index` in the list; a full chunk is split in half first
+    Parameters:
+        - const T &item: a const reference to the item to be inserted
+        - size_t index: the index at which to place `item`
+    Return: None
+    Exceptions:
+        - std::out_of_range if `index` exceeds the size of the list
+    */
+    void insert(const T &item, size_t index);
+
+
+    /*
+    Description:
+        - Inserts `item` at position `index` in the list, moving it into the list; a full chunk is split in half first
+    Parameters:
+        - T &&item: the item to be inserted
+        - size_t index: the index at which to place `item`
+    Return: None
+    Exceptions:
+        - std::out_of_range if `index` exceeds the size of the list
+    */
+    void insert(T &&item, size_t index);
+
+
+    /*
+    Description:
+        - Erases the element at position `index`; a chunk left empty is freed, and one left less than half full
+          takes in the next chunk if it fits
+    Parameters:
+        - size_t index: the position of the element to delete
+    Return: None
+    Exceptions:
+        - std::out_of_range if `index` is invalid
+    */
+    void erase(size_t index);
+
+
+    /*
+    Description:
+        - Returns the index of the first element equal to `item`
+    Parameters:
+        - const T &item: the value to be searched for in the list
+    Return:
+        - The smallest index of an element equal to `item`. If no such element exists, return the value of numElements (which is not a valid index)
+    Exceptions: None
+    */
+    size_t search(const T &item) const;
+
+
+    /*
+    Description:
+        - Inserts item at the front of the list
+    Parameters:
+        - const T &item: the value to be inserted
+    Return: None
+    Exceptions: None
+    */
+    void push_front(const T &item);
+
+
+    /*
+    Description:
+        - Inserts item at the front of the list, moving it into place
+    Parameters:
+        - T &&item: the value to be inserted
+    Return: None
+    Exceptions: None
+    */
+    void push_front(T &&item);
+
+
+    /*
+    Description:
+        - Constructs an item at the front of the list from `args`
+    Parameters:
+        - Args&&... args: the arguments forwarded to the constructor of T
+    Return:
+        - A reference to the new item
+    Exceptions: None
+    */
+    template<class... Args>
+    T& emplace_front(Args&&... args);
+
+
+    /*
+    Description:
+        - Inserts item at the end of the list
+    Parameters:
+        - const T &item: the value to be inserted
+    Return: None
+    Exceptions: None
+    */
+    void push_back(const T &item);
+
+
+    /*
+    Description:
+        - Inserts item at the end of the list, moving it into place
+    Parameters:
+        - T &&item: the value to be inserted
+    Return: None
+    Exceptions: None
+    */
+    void push_back(T &&item);
+
+
+    /*
+    Description:
+        - Constructs an item at the end of the list from `args`
+    Parameters:
+        - Args&&... args: the arguments forwarded to the constructor of T
+    Return:
+        - A reference to the new item
+    Exceptions: None
+    */
+    template<class... Args>
+    T& emplace_back(Args&&... args);
+
+
+    /*
+    Description:
+        - Erases the element at the front of the list and returns its value
+    Parameters: None
+    Return:
+        - The value of the element previously at the front of the list
+    Exceptions:
+        - std::out_of_range if the list is empty
+    */
+    T pop_front(void);
+
+
+    /*
+    Description:
+        - Erases the element at the back of the list and returns its value
+    Parameters: None
+    Return:
+        - The value of the element previously at the back of the list
+    Exceptions:
+        - std::out_of_range if the list is empty
+    */
+    T pop_back(void);
+
+
+    /*
+    Description:
+        - Finds the element at position `index` and returns a reference to it
+    Parameters:
+        - size_t index: index of the value to find
+    Return:
+        - A reference to the element at position `index`
+    Exceptions:
+        - std::out_of_range if `index` is invalid
+    */
+    T& operator[](size_t index);
+
+
+    /*
+    Description:
+        - Computes the size of the list
+    Parameters: None
+    Return:
+        - The size of the list
+    Exceptions: None
+    */
+    size_t size(void) const;
+
+
+    /*
+    Description:
+        - Checks whether the list is empty
+    Parameters: None
+    Return:
+        - `true` if the list is empty, `false` otherwise
+    Exceptions: None
+    */
+    bool empty(void) const;
+
+
+    /*
+    Description:
+        - Returns a copy of the allocator the list uses for its chunks
+    Parameters: None
+    Return:
+        - The allocator, rebound to T
+    Exceptions: None
+    */
+    Allocator get_allocator(void) const;
+
+
+    /*
+    Description:
+        - Creates a new list holding the elements of the current list followed by the elements of `list`
+    Parameters:
+        - const UnrolledDoublyLinkedList<T> &list: the list to concatenate
+    Return:
+        - The concatenated list
+    Exceptions: None
+    */
+    UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> concatenate(const UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &list) const &;
+
+
+    /*
+    Description:
+        - Concatenates two temporaries by linking the chunks of `list` after the current list's, copying nothing
+    Parameters:
+        - UnrolledDoublyLinkedList<T> &&list: the list to concatenate; it is left empty
+    Return:
+        - The concatenated list
+    Exceptions: None
+    */
+    UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> concatenate(UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &&list) &&;
+
+
+    /*
+    Description:
+        - Moves all elements of `list` into the current list, before position `index`, by relinking its chunks; the
+          chunk holding `index` is split there if needed
+    Parameters:
+        - size_t index: the position at which the spliced elements start
+        - UnrolledDoublyLinkedList<T> &&list: the list to splice in; it is left empty
+    Return: None
+    Exceptions:
+        - std::out_of_range if `index` exceeds the size of the list
+    */
+    void splice(size_t index, UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &&list);
+
+
+    /*
+    Description:
+        - Moves all elements of `list` to the end of the current list in O(1)
+    Parameters:
+        - UnrolledDoublyLinkedList<T> &&list: the list to append; it is left empty
+    Return: None
+    Exceptions: None
+    */
+    void append(UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &&list);
+
+
+    /*
+    Description:
+        - Checks whether two lists hold equal elements in the same order, however they are split into chunks
+    Parameters:
+        - const UnrolledDoublyLinkedList<T> &rhs: the list to compare with
+    Return:
+        - `true` if the lists are equal, `false` otherwise
+    Exceptions: None
+    */
+    bool operator==(const UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &rhs) const;
+
+
+    /*
+    Description:
+        - Checks whether two lists differ
+    Parameters:
+        - const UnrolledDoublyLinkedList<T> &rhs: the list to compare with
+    Return:
+        - `true` if the lists are different, `false` otherwise
+    Exceptions: None
+    */
+    bool operator!=(const UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &rhs) const;
+
+
+    /*
+    Description:
+        - Iterators over the elements, from head to tail
+    Parameters: None
+    Return:
+        - An iterator to the first element, or the past-the-end iterator
+    Exceptions: None
+    */
+    iterator begin(void);
+    iterator end(void);
+    const_iterator begin(void) const;
+    const_iterator end(void) const;
+};
@@ -0,0 +1,697 @@
+/*
+UnrolledDoublyLinkedList.tpp
+A file that contains the implementation of the UnrolledDoublyLinkedList class methods in the UnrolledDoublyLinkedList.hpp file.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include "UnrolledDoublyLinkedList.hpp"
+
+using namespace std;
+
+// Default constructor.
+// Parameter: NONE.
+// Return value: NONE.
+template <class T, class Allocator, size_t ChunkBytes>
+UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::UnrolledDoublyLinkedList(void) {
+    head = nullptr;
+    tail = nullptr;
+    numElements = 0;
+    cursor = nullptr;
+    cursorStart = 0;
+}
+
+// Allocator constructor.
+// Parameter: The allocator to take the chunks from.
+// Return value: NONE.
+template <class T, class Allocator, size_t ChunkBytes>
+UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::UnrolledDoublyLinkedList(const Allocator &allocator) : allocator(allocator) {
+    head = nullptr;
+    tail = nullptr;
+    numElements = 0;
+    cursor = nullptr;
+    cursorStart = 0;
+}
+
+// Create chunk. This allocates an empty chunk from the allocator.
+// Parameter: None.
+// Return value: A pointer to the new chunk, with null links.
+template <class T, class Allocator, size_t ChunkBytes>
+typename UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::Chunk* UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::createChunk(void) {
+    Chunk *chunk = new (ChunkAllocatorTraits::allocate(allocator, 1)) Chunk;
+    chunk->prev = nullptr;
+    chunk->next = nullptr;
+    chunk->count = 0;
+    return chunk;
+}
+
+// Destroy chunk. This destroys the elements of a chunk and gives its memory back to the allocator.
+// Parameter: The chunk to destroy.
+// Return value: None.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::destroyChunk(Chunk *chunk) {
+    T *values = chunk->values();
+    for (size_t i = 0; i < chunk->count; i++) {
+        values[i].~T();
+    }
+    ChunkAllocatorTraits::deallocate(allocator, chunk, 1);
+}
+
+// Destroy chunks. This destroys every chunk and leaves the list empty.
+// Parameter: None.
+// Return value: None.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::destroyChunks(void) {
+    Chunk *current = head;
+    while (current != nullptr) {
+        Chunk *temp = current->next;
+        destroyChunk(current);
+        current = temp;
+    }
+    head = nullptr;
+    tail = nullptr;
+    numElements = 0;
+    cursor = nullptr;
+}
+
+// Link chunk. This links a chunk into the list after another one.
+// Parameter: The chunk to link, and the chunk it follows, or nullptr to link it at the front.
+// Return value: None.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::linkChunk(Chunk *chunk, Chunk *before) {
+    Chunk *after = (before != nullptr) ? before->next : head;
+    chunk->prev = before;
+    chunk->next = after;
+    if (before != nullptr) {
+        before->next = chunk;
+    } else {
+        head = chunk;
+    }
+    if (after != nullptr) {
+        after->prev = chunk;
+    } else {
+        tail = chunk;
+    }
+}
+
+// Remove chunk. This unlinks a chunk from the list and destroys it.
+// Parameter: The chunk to remove.
+// Return value: None.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::removeChunk(Chunk *chunk) {
+    if (chunk->prev != nullptr) {
+        chunk->prev->next = chunk->next;
+    } else {
+        head = chunk->next;
+    }
+    if (chunk->next != nullptr) {
+        chunk->next->prev = chunk->prev;
+    } else {
+        tail = chunk->prev;
+    }
+    if (cursor == chunk) {
+        cursor = nullptr;
+    }
+    destroyChunk(chunk);
+}
+
+// Split chunk. This moves the elements of a chunk from a given position on into a new chunk right after it.
+// Parameter: The chunk to split, and the position of the first element to move.
+// Return value: The new chunk.
+template <class T, class Allocator, size_t ChunkBytes>
+typename UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::Chunk* UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::splitChunk(Chunk *chunk, size_t offset) {
+    Chunk *right = createChunk();
+    T *from = chunk->values();
+    T *to = right->values();
+    for (size_t i = offset; i < chunk->count; i++) {
+        new (to + right->count++) T(std::move(from[i]));
+        from[i].~T();
+    }
+    chunk->count = offset;
+    linkChunk(right, chunk);
+    return right;
+}
+
+// Emplace at. This constructs an element in a chunk that has room, shifting the elements after it one place right.
+// Parameter: The chunk, the position of the new element, and the arguments for the constructor of the value.
+// Return value: Reference to the new element.
+template <class T, class Allocator, size_t ChunkBytes>
+template <class... Args>
+T& UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::emplaceAt(Chunk *chunk, size_t offset, Args&&... args) {
+    T *values = chunk->values();
+    if (offset == chunk->count) {
+        new (values + offset) T(std::forward<Args>(args)...);
+    } else {
+        // Build the element first, so that nothing has moved if its constructor throws.
+        T item(std::forward<Args>(args)...);
+        new (values + chunk->count) T(std::move(values[chunk->count - 1]));
+        move_backward(values + offset, values + chunk->count - 1, values + chunk->count);
+        values[offset] = std::move(item);
+    }
+    chunk->count++;
+    return values[offset];
+}
+
+// Erase at. This destroys an element of a chunk, shifting the elements after it one place left.
+// Parameter: The chunk, and the position of the element.
+// Return value: None.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::eraseAt(Chunk *chunk, size_t offset) {
+    T *values = chunk->values();
+    std::move(values + offset + 1, values + chunk->count, values + offset);
+    values[chunk->count - 1].~T();
+    chunk->count--;
+}
+
+// Get chunk. This finds the chunk holding a given index, stepping a whole chunk at a time from whichever of the
+// head, the tail and the cursor is closest, and leaves the cursor on that chunk.
+// Parameter: The index position to find, and the position within the chunk, which is set.
+// Return value: A pointer to the chunk holding the given index.
+// Throws: std::out_of_range if the index is out of range.
+template <class T, class Allocator, size_t ChunkBytes>
+typename UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::Chunk* UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::getChunk(size_t index, size_t &offset) {
+    if (index >= numElements) {
+        throw out_of_range("Index out of range.");
+    }
+    Chunk *current = head;
+    size_t start = 0;
+    size_t distance = index;
+    if (numElements - index < distance) {
+        current = tail;
+        start = numElements - tail->count;
+        distance = numElements - index;
+    }
+    if (cursor != nullptr) {
+        size_t fromCursor = (index > cursorStart) ? index - cursorStart : cursorStart - index;
+        if (fromCursor < distance) {
+            current = cursor;
+            start = cursorStart;
+        }
+    }
+    while (index < start) {
+        current = current->prev;
+        start -= current->count;
+    }
+    while (index >= start + current->count) {
+        start += current->count;
+        current = current->next;
+    }
+    cursor = current;
+    cursorStart = start;
+    offset = index - start;
+    return current;
+}
+
+// Copy constructor. This copies the elements of a list into full chunks.
+// Parameter: A given list.
+// Return value: NONE.
+template <class T, class Allocator, size_t ChunkBytes>
+UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::UnrolledDoublyLinkedList(const UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>& list) {
+    head = nullptr;
+    tail = nullptr;
+    numElements = 0;
+    cursor = nullptr;
+    cursorStart = 0;
+    for (const Chunk *current = list.head; current != nullptr; current = current->next) {
+        for (size_t i = 0; i < current->count; i++) {
+            emplace_back(current->values()[i]);
+        }
+    }
+}
+
+// Move constructor. This takes over the chunks and the allocator of another list, which is left empty with a new
+// allocator, so that the two lists share no pool.
+// Parameter: A given list.
+// Return value: NONE.
+template <class T, class Allocator, size_t ChunkBytes>
+UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::UnrolledDoublyLinkedList(UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>&& list) noexcept : allocator(std::move(list.allocator)) {
+    list.allocator = ChunkAllocator();
+    head = list.head;
+    tail = list.tail;
+    numElements = list.numElements;
+    cursor = list.cursor;
+    cursorStart = list.cursorStart;
+    list.head = nullptr;
+    list.tail = nullptr;
+    list.numElements = 0;
+    list.cursor = nullptr;
+}
+
+// Can adopt chunks. This checks whether the chunks of another list can be linked into this one and freed by our allocator.
+// Parameter: The list whose chunks will be taken over.
+// Return value: True if the chunks can be relinked, false if the elements have to be moved one by one.
+template <class T, class Allocator, size_t ChunkBytes>
+bool UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::canAdoptChunks(UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &list) {
+    if (allocator == list.allocator) {
+        return true;
+    }
+    if constexpr (IsPoolAllocator<ChunkAllocator>::value) {
+        allocator.adopt(list.allocator);
+        return true;
+    }
+    return false;
+}
+
+// Destructor.
+// Parameter: None.
+// Return value: None.
+template <class T, class Allocator, size_t ChunkBytes>
+UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::~UnrolledDoublyLinkedList(void) {
+    if constexpr (IsPoolAllocator<Allocator>::value && is_trivially_destructible<T>::value) {
+        // Nothing to run per chunk: the blocks are released with the pool if no one else uses it.
+        if (allocator.uniquePool()) {
+            return;
+        }
+    }
+    destroyChunks();
+}
+
+// Assignment Operator. This swaps in the chunks of a list the caller has already copied (or moved).
+// Parameter: The list to be assigned.
+// Return value: This list.
+template <class T, class Allocator, size_t ChunkBytes>
+UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>& UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::operator=(UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> rhs) {
+    // The old chunks are destroyed with rhs.
+    std::swap(head, rhs.head);
+    std::swap(tail, rhs.tail);
+    std::swap(numElements, rhs.numElements);
+    std::swap(cursor, rhs.cursor);
+    std::swap(cursorStart, rhs.cursorStart);
+    std::swap(allocator, rhs.allocator);
+    return *this;
+}
+
+// Insert operator. This inserts an element at a given index.
+// Parameters: Value and the index position to be inserted.
+// Return value: Throws std::out_of_range if the index is out of range.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::insert(const T &item, size_t index) {
+    if (index > numElements) {
+        throw out_of_range("Index out of range.");
+    }
+    emplaceIndex(index, item);
+}
+
+// Insert operator. This moves an element in at a given index.
+// Parameters: Value and the index position to be inserted.
+// Return value: Throws std::out_of_range if the index is out of range.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::insert(T &&item, size_t index) {
+    if (index > numElements) {
+        throw out_of_range("Index out of range.");
+    }
+    emplaceIndex(index, std::move(item));
+}
+
+// Emplace index operator. This constructs an element at a given index, which has already been checked, splitting
+// the chunk that holds the index in half if it is full.
+// Parameters: The index position and the arguments for the constructor of the new value.
+// Return value: None.
+template <class T, class Allocator, size_t ChunkBytes>
+template <class... Args>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::emplaceIndex(size_t index, Args&&... args) {
+    if (index == numElements) {
+        emplace_back(std::forward<Args>(args)...);
+        return;
+    }
+    size_t offset;
+    Chunk *chunk = getChunk(index, offset);
+    if (chunk->count == chunkCapacity) {
+        Chunk *right = splitChunk(chunk, chunkCapacity / 2);
+        if (offset > chunk->count) {
+            offset -= chunk->count;
+            chunk = right;
+        }
+    }
+    emplaceAt(chunk, offset, std::forward<Args>(args)...);
+    numElements++;
+    // The chunk that received the item starts where the insertion point was, less its offset.
+    cursor = chunk;
+    cursorStart = index - offset;
+}
+
+// Erase operator. This deletes the element at a given index. An emptied chunk is freed, and a chunk left less than
+// half full takes in the next chunk if both fit in one.
+// Parameters: Index position of the element to be deleted.
+// Return value: Throws std::out_of_range if the index is out of range.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::erase(size_t index) {
+    size_t offset;
+    Chunk *chunk = getChunk(index, offset);
+    eraseAt(chunk, offset);
+    numElements--;
+    if (chunk->count == 0) {
+        removeChunk(chunk);
+        return;
+    }
+    Chunk *next = chunk->next;
+    if (next != nullptr && chunk->count < chunkCapacity / 2 && chunk->count + next->count <= chunkCapacity) {
+        T *to = chunk->values() + chunk->count;
+        T *from = next->values();
+        for (size_t i = 0; i < next->count; i++) {
+            new (to + i) T(std::move(from[i]));
+            from[i].~T();
+        }
+        chunk->count += next->count;
+        next->count = 0;
+        removeChunk(next);
+    }
+}
+
+// Search operator. This returns the index of the first element equal to 'item', scanning each chunk's elements
+// in a row.
+// Parameter: value 'item' to be found in the list.
+// Return value: The smallest index of an element equal to 'item'. If no such element exists, returns numElements.
+template <class T, class Allocator, size_t ChunkBytes>
+size_t UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::search(const T &item) const {
+    size_t start = 0;
+    for (const Chunk *current = head; current != nullptr; current = current->next) {
+        const T *values = current->values();
+        for (size_t i = 0; i < current->count; i++) {
+            if (values[i] == item) {
+                return start + i;
+            }
+        }
+        start += current->count;
+    }
+    return numElements;
+}
+
+// Push front operator. This adds 'item' at the start of the list.
+// Parameter: value 'item' to be added.
+// Return value: None.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::push_front(const T &item) {
+    emplace_front(item);
+}
+
+// Push front operator. This moves 'item' to the start of the list.
+// Parameter: value 'item' to be added.
+// Return value: None.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::push_front(T &&item) {
+    emplace_front(std::move(item));
+}
+
+// Emplace front operator. This constructs an element at the start of the list, in the head chunk if it has room
+// and in a new chunk otherwise.
+// Parameter: the arguments for the constructor of the new value.
+// Return value: Reference to the new value.
+template <class T, class Allocator, size_t ChunkBytes>
+template <class... Args>
+T& UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::emplace_front(Args&&... args) {
+    if (head == nullptr || head->count == chunkCapacity) {
+        Chunk *chunk = createChunk();
+        try {
+            emplaceAt(chunk, 0, std::forward<Args>(args)...);
+        } catch (...) {
+            destroyChunk(chunk);
+            throw;
+        }
+        linkChunk(chunk, nullptr);
+    } else {
+        emplaceAt(head, 0, std::forward<Args>(args)...);
+    }
+    numElements++;
+    // Every chunk but the head now starts one index later.
+    if (cursor != head) {
+        cursorStart++;
+    }
+    return head->values()[0];
+}
+
+// Push back operator. This adds 'item' at the end of the list.
+// Parameter: value 'item' to be added.
+// Return value: None.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::push_back(const T &item) {
+    emplace_back(item);
+}
+
+// Push back operator. This moves 'item' to the end of the list.
+// Parameter: value 'item' to be added.
+// Return value: None.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::push_back(T &&item) {
+    emplace_back(std::move(item));
+}
+
+// Emplace back operator. This constructs an element at the end of the list, in the tail chunk if it has room and
+// in a new chunk otherwise.
+// Parameter: the arguments for the constructor of the new value.
+// Return value: Reference to the new value.
+template <class T, class Allocator, size_t ChunkBytes>
+template <class... Args>
+T& UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::emplace_back(Args&&... args) {
+    if (tail == nullptr || tail->count == chunkCapacity) {
+        Chunk *chunk = createChunk();
+        try {
+            emplaceAt(chunk, 0, std::forward<Args>(args)...);
+        } catch (...) {
+            destroyChunk(chunk);
+            throw;
+        }
+        linkChunk(chunk, tail);
+        numElements++;
+        return chunk->values()[0];
+    }
+    numElements++;
+    return emplaceAt(tail, tail->count, std::forward<Args>(args)...);
+}
+
+// Pop front operator. This removes the first element of the list, and the head chunk if it empties.
+// Parameter: None.
+// Return value: The value of the removed element.
+// Throws: std::out_of_range if the list is empty.
+template <class T, class Allocator, size_t ChunkBytes>
+T UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::pop_front(void) {
+    if (numElements == 0) {
+        throw out_of_range("The list is empty!");
+    }
+    T return_value = std::move(head->values()[0]);
+    eraseAt(head, 0);
+    numElements--;
+    // Every chunk but the head now starts one index earlier.
+    if (cursor != head) {
+        cursorStart--;
+    }
+    if (head->count == 0) {
+        removeChunk(head);
+    }
+    return return_value;
+}
+
+// Pop back operator. This removes the last element of the list, and the tail chunk if it empties.
+// Parameter: None.
+// Return value: The value of the removed element.
+// Throws: std::out_of_range if the list is empty.
+template <class T, class Allocator, size_t ChunkBytes>
+T UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::pop_back(void) {
+    if (numElements == 0) {
+        throw out_of_range("The list is empty");
+    }
+    T return_value = std::move(tail->values()[tail->count - 1]);
+    eraseAt(tail, tail->count - 1);
+    numElements--;
+    if (tail->count == 0) {
+        removeChunk(tail);
+    }
+    return return_value;
+}
+
+// Find by index operator. This retrieves the element at a given index.
+// Parameter: The index position to find.
+// Return value: Reference to the element at the given index.
+// Throws: std::out_of_range if the index is out of range.
+template <class T, class Allocator, size_t ChunkBytes>
+T& UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::operator[](size_t index) {
+    size_t offset;
+    Chunk *chunk = getChunk(index, offset);
+    return chunk->values()[offset];
+}
+
+// Get allocator. This returns a copy of the allocator of the chunks.
+// Parameter: None.
+// Return value: The allocator, rebound to T.
+template <class T, class Allocator, size_t ChunkBytes>
+Allocator UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::get_allocator(void) const {
+    return Allocator(allocator);
+}
+
+// Size operator. This returns the number of elements in the list.
+// Parameter: None.
+// Return value: The number of elements in the list.
+template <class T, class Allocator, size_t ChunkBytes>
+size_t UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::size(void) const {
+    return numElements;
+}
+
+// Empty operator. This checks whether the list is empty.
+// Parameter: None.
+// Return value: True if the list is empty, False otherwise.
+template <class T, class Allocator, size_t ChunkBytes>
+bool UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::empty(void) const {
+    return (numElements == 0);
+}
+
+// Concatenation operator. This returns a new list with the elements of the current list followed by those of another.
+// Parameter: The list to be concatenated with the current list.
+// Return value: A new list after concatenation.
+template <class T, class Allocator, size_t ChunkBytes>
+UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::concatenate(const UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &list) const & {
+    UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> result(*this);
+    for (const Chunk *current = list.head; current != nullptr; current = current->next) {
+        for (size_t i = 0; i < current->count; i++) {
+            result.emplace_back(current->values()[i]);
+        }
+    }
+    return result;
+}
+
+// Concatenation operator for temporaries. This links the chunks of both lists together instead of copying them.
+// Parameter: The list to be concatenated with the current list; it is left empty.
+// Return value: The current list followed by the elements of the other list.
+template <class T, class Allocator, size_t ChunkBytes>
+UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::concatenate(UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &&list) && {
+    append(std::move(list));
+    return std::move(*this);
+}
+
+// Splice operator. This moves all chunks of another list into the current list, before the given index. The chunk
+// holding the index is split in two there, unless the index starts a chunk.
+// Parameter: The index at which the spliced elements start, and the list to splice in, which is left empty.
+// Return value: Throws std::out_of_range if the index is out of range.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::splice(size_t index, UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &&list) {
+    if (index > numElements) {
+        throw out_of_range("Index out of range.");
+    }
+    if (list.numElements == 0 || &list == this) {
+        return;
+    }
+    if (!canAdoptChunks(list)) {
+        // The allocators cannot free each other's chunks: move the elements over instead.
+        size_t position = index;
+        while (!list.empty()) {
+            insert(list.pop_front(), position++);
+        }
+        return;
+    }
+
+    // Find the chunk the spliced chain goes after; appending needs no walk.
+    Chunk *before = tail;
+    if (index < numElements) {
+        size_t offset;
+        Chunk *chunk = getChunk(index, offset);
+        if (offset == 0) {
+            before = chunk->prev;
+        } else {
+            splitChunk(chunk, offset);
+            before = chunk;
+        }
+    }
+    Chunk *after = (before != nullptr) ? before->next : head;
+
+    list.head->prev = before;
+    list.tail->next = after;
+    if (before != nullptr) {
+        before->next = list.head;
+    } else {
+        head = list.head;
+    }
+    if (after != nullptr) {
+        after->prev = list.tail;
+    } else {
+        tail = list.tail;
+    }
+    numElements += list.numElements;
+    cursor = nullptr;
+
+    list.head = nullptr;
+    list.tail = nullptr;
+    list.numElements = 0;
+    list.cursor = nullptr;
+}
+
+// Append operator. This moves all chunks of another list to the end of the current list in O(1).
+// Parameter: The list to append, which is left empty.
+// Return value: None.
+template <class T, class Allocator, size_t ChunkBytes>
+void UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::append(UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &&list) {
+    splice(numElements, std::move(list));
+}
+
+// Equality operator. This checks whether rhs list holds equal elements in the same order.
+// Parameter: rhs list.
+// Return value: True if the lists are equal, False otherwise.
+template <class T, class Allocator, size_t ChunkBytes>
+bool UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::operator==(const UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &rhs) const {
+    if (numElements != rhs.numElements) {
+        return false;
+    }
+    // The lists may be chunked differently: compare runs that are contiguous in both.
+    const Chunk *left = head;
+    const Chunk *right = rhs.head;
+    size_t leftOffset = 0;
+    size_t rightOffset = 0;
+    while (left != nullptr) {
+        size_t run = min(left->count - leftOffset, right->count - rightOffset);
+        if (!std::equal(left->values() + leftOffset, left->values() + leftOffset + run, right->values() + rightOffset)) {
+            return false;
+        }
+        leftOffset += run;
+        rightOffset += run;
+        if (leftOffset == left->count) {
+            left = left->next;
+            leftOffset = 0;
+        }
+        if (rightOffset == right->count) {
+            right = right->next;
+            rightOffset = 0;
+        }
+    }
+    return true;
+}
+
+// Inequality operator. This checks whether rhs list is different from the current list.
+// Parameter: rhs list.
+// Return value: True if the lists are different, False otherwise.
+template <class T, class Allocator, size_t ChunkBytes>
+bool UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::operator!=(const UnrolledDoublyLinkedList<T, Allocator, ChunkBytes> &rhs) const {
+    return !(*this == rhs);
+}
+
+// Begin. This returns an iterator to the first element.
+// Parameter: None.
+// Return value: An iterator to the first element, or end() if the list is empty.
+template <class T, class Allocator, size_t ChunkBytes>
+typename UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::iterator UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::begin(void) {
+    return iterator(head, 0, this);
+}
+
+// End. This returns the past-the-end iterator of the list.
+// Parameter: None.
+// Return value: The past-the-end iterator.
+template <class T, class Allocator, size_t ChunkBytes>
+typename UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::iterator UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::end(void) {
+    return iterator(nullptr, 0, this);
+}
+
+// Begin. This returns a read-only iterator to the first element.
+// Parameter: None.
+// Return value: An iterator to the first element, or end() if the list is empty.
+template <class T, class Allocator, size_t ChunkBytes>
+typename UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::const_iterator UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::begin(void) const {
+    return const_iterator(head, 0, this);
+}
+
+// End. This returns the read-only past-the-end iterator of the list.
+// Parameter: None.
+// Return value: The past-the-end iterator.
+template <class T, class Allocator, size_t ChunkBytes>
+typename UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::const_iterator UnrolledDoublyLinkedList<T, Allocator, ChunkBytes>::end(void) const {
+    return const_iterator(nullptr, 0, this);
+}
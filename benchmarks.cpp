@@ -0,0 +1,583 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <new>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BST.hpp"
+#include "BST.tpp"
+#include "BSTMultiset.hpp"
+#include "BSTMultiset.tpp"
+#include "BTree.hpp"
+#include "BTree.tpp"
+#include "LRUCache.hpp"
+#include "LRUCache.tpp"
+#include "UnrolledDoublyLinkedList.hpp"
+#include "UnrolledDoublyLinkedList.tpp"
+
+using namespace std;
+
+// Benchmark suite; build with optimizations, e.g. g++ -std=c++17 -O2 -pthread benchmarks.cpp -o benchmarks
+// Usage: ./benchmarks [--sizes=1000,10000,...] [--filter=text] [--json=file] [--parallel=count]
+//   --sizes     number of keys per run, from 1K up to 100M (default 1000,10000,100000,1000000)
+//   --filter    only runs whose "structure/stream" name contains text
+//   --json      also writes every result to file as JSON, one object per run, for diffing between builds
+//   --parallel  instead times BST copy, destruction and reduce with 1, 2, 4, ... threads on count values
+//
+// LRUCache runs on the random, zipfian and hotset streams only: it holds n / 10 keys and serves the lookups,
+// putting each key that misses, which evicts once the cache is full.
+//
+// Key streams:
+//   sequential  keys 0..n-1 inserted and looked up in ascending order
+//   random      a random permutation of 0..n-1 inserted, uniform random lookups
+//   zipfian     a random permutation inserted, lookups skewed towards a few hot keys (Zipf, s = 0.99)
+//   hotset      a random permutation inserted, 90% of the lookups on 1% of the keys and the rest uniform
+//   sorted      adversarial: keys inserted in descending order, lookups of the smallest keys, which sit at the
+//               bottom of an unbalanced tree; the unbalanced BST is skipped above 20000 keys (quadratic)
+//   repeated    n / 100 distinct keys, each inserted 100 times in random order, uniform random lookups; duplicates
+//               form chains in BST<>, so the unbalanced BST is skipped above 20000 keys, and std::set is skipped
+//
+// Trees with contains_batch also run the lookups in batches of 256 (search_batch).
+//
+// Every phase reports throughput, latency percentiles from individually timed operations (at most 100000 per
+// phase, spread evenly; bulk phases such as copy are timed as one call and counted as n operations), allocations
+// per operation (every global operator new is counted) and the peak
+// resident set size since the structure was created.
+
+
+// Allocation counting. GCC pairs the new-expressions below with the free calls and warns; they do match.
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+static atomic<size_t> allocationCount(0);
+
+void* operator new(size_t bytes) {
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    void *pointer = malloc(bytes == 0 ? 1 : bytes);
+    if (pointer == NULL) {
+        throw bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](size_t bytes) {
+    return operator new(bytes);
+}
+
+void* operator new(size_t bytes, align_val_t alignment) {
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    size_t align = static_cast<size_t>(alignment);
+    void *pointer = aligned_alloc(align, (bytes + align - 1) / align * align);
+    if (pointer == NULL) {
+        throw bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](size_t bytes, align_val_t alignment) {
+    return operator new(bytes, alignment);
+}
+
+void operator delete(void *pointer) noexcept { free(pointer); }
+void operator delete[](void *pointer) noexcept { free(pointer); }
+void operator delete(void *pointer, size_t) noexcept { free(pointer); }
+void operator delete[](void *pointer, size_t) noexcept { free(pointer); }
+void operator delete(void *pointer, align_val_t) noexcept { free(pointer); }
+void operator delete[](void *pointer, align_val_t) noexcept { free(pointer); }
+void operator delete(void *pointer, size_t, align_val_t) noexcept { free(pointer); }
+void operator delete[](void *pointer, size_t, align_val_t) noexcept { free(pointer); }
+
+
+// Resident set size, from /proc (Linux); 0 elsewhere.
+
+// Resets the peak resident set size of the process to the current one.
+void resetPeakRSS() {
+    ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs) {
+        clearRefs << "5";
+    }
+}
+
+// Peak resident set size since the last reset, in KiB.
+size_t peakRSSKiB() {
+    ifstream status("/proc/self/status");
+    string line;
+    while (getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return strtoul(line.c_str() + 6, NULL, 10);
+        }
+    }
+    return 0;
+}
+
+
+// Results.
+struct Result {
+    string structure;
+    string stream;
+    size_t size;
+    string operation;
+    size_t ops;
+    double seconds;
+    double p50, p90, p99, p999;
+    double allocationsPerOp;
+    size_t peakRSS;
+    string skipped;
+};
+
+vector<Result> results;
+
+double percentile(vector<double> &samples, double fraction) {
+    if (samples.empty()) {
+        return 0;
+    }
+    size_t index = min(samples.size() - 1, (size_t)(fraction * samples.size()));
+    nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+void report(const Result &result) {
+    results.push_back(result);
+    cout << "  " << result.structure << " " << result.stream << " n=" << result.size << " " << result.operation;
+    if (!result.skipped.empty()) {
+        cout << ": skipped (" << result.skipped << ")" << endl;
+        return;
+    }
+    cout << ": " << (result.ops / result.seconds / 1e6) << " Mops/s, p50 " << result.p50 << " ns, p99 " << result.p99
+         << " ns, p99.9 " << result.p999 << " ns, " << result.allocationsPerOp << " allocs/op, peak RSS "
+         << result.peakRSS / 1024 << " MiB" << endl;
+}
+
+// Runs op(i) for i in [0, calls), timing every stride-th call on its own, and reports the phase. Each call does
+// itemsPerCall operations (n for bulk phases such as copy), which throughput and allocations are counted in.
+template<class Op>
+void runPhase(const string &structure, const string &stream, size_t size, const string &operation, size_t calls, Op op,
+              size_t itemsPerCall = 1) {
+    size_t ops = calls;
+    size_t stride = max((size_t)1, calls / 100000);
+    vector<double> samples;
+    samples.reserve(calls / stride + 1);
+    size_t allocationsBefore = allocationCount.load();
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (size_t i = 0; i < calls; i++) {
+        if (i % stride == 0) {
+            chrono::steady_clock::time_point before = chrono::steady_clock::now();
+            op(i);
+            samples.push_back(chrono::duration<double, nano>(chrono::steady_clock::now() - before).count());
+        } else {
+            op(i);
+        }
+    }
+    Result result;
+    result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    ops = calls * itemsPerCall;
+    // the samples vector allocates once, before the clock starts
+    result.allocationsPerOp = (double)(allocationCount.load() - allocationsBefore) / max((size_t)1, ops);
+    result.structure = structure;
+    result.stream = stream;
+    result.size = size;
+    result.operation = operation;
+    result.ops = ops;
+    result.p50 = percentile(samples, 0.5);
+    result.p90 = percentile(samples, 0.9);
+    result.p99 = percentile(samples, 0.99);
+    result.p999 = percentile(samples, 0.999);
+    result.peakRSS = peakRSSKiB();
+    report(result);
+}
+
+void reportSkipped(const string &structure, const string &stream, size_t size, const string &reason) {
+    Result result = Result();
+    result.structure = structure;
+    result.stream = stream;
+    result.size = size;
+    result.operation = "all";
+    result.skipped = reason;
+    report(result);
+}
+
+
+// Key streams.
+struct Stream {
+    string name;
+    vector<int> inserts;
+    vector<int> lookups;
+};
+
+// Zipf-distributed ranks in [0, n), by inversion of the precomputed cumulative distribution.
+vector<int> zipfRanks(size_t n, size_t count, double s, mt19937_64 &random) {
+    vector<double> cumulative(n);
+    double total = 0;
+    for (size_t i = 0; i < n; i++) {
+        total += 1.0 / pow((double)(i + 1), s);
+        cumulative[i] = total;
+    }
+    uniform_real_distribution<double> uniform(0, total);
+    vector<int> ranks(count);
+    for (size_t i = 0; i < count; i++) {
+        ranks[i] = (int)(lower_bound(cumulative.begin(), cumulative.end(), uniform(random)) - cumulative.begin());
+    }
+    return ranks;
+}
+
+Stream makeStream(const string &name, size_t n) {
+    mt19937_64 random(271);
+    Stream stream;
+    stream.name = name;
+    stream.inserts.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        stream.inserts[i] = (int)i;
+    }
+    stream.lookups = stream.inserts;
+    if (name == "random" || name == "zipfian" || name == "hotset") {
+        shuffle(stream.inserts.begin(), stream.inserts.end(), random);
+    }
+    if (name == "random") {
+        uniform_int_distribution<int> uniform(0, (int)n - 1);
+        for (size_t i = 0; i < n; i++) {
+            stream.lookups[i] = uniform(random);
+        }
+    } else if (name == "zipfian") {
+        // hot ranks map to keys scattered over the whole range
+        vector<int> ranks = zipfRanks(n, n, 0.99, random);
+        for (size_t i = 0; i < n; i++) {
+            stream.lookups[i] = stream.inserts[ranks[i]];
+        }
+    } else if (name == "hotset") {
+        // the hot keys are the first 1% of the shuffled keys, so they are spread over the whole range
+        size_t hot = max(n / 100, (size_t)1);
+        uniform_int_distribution<size_t> hotKey(0, hot - 1);
+        uniform_int_distribution<size_t> anyKey(0, n - 1);
+        uniform_int_distribution<int> percent(0, 99);
+        for (size_t i = 0; i < n; i++) {
+            stream.lookups[i] = stream.inserts[(percent(random) < 90) ? hotKey(random) : anyKey(random)];
+        }
+    } else if (name == "repeated") {
+        size_t distinct = max(n / 100, (size_t)1);
+        uniform_int_distribution<int> uniform(0, (int)distinct - 1);
+        for (size_t i = 0; i < n; i++) {
+            stream.inserts[i] = (int)(i % distinct);
+            stream.lookups[i] = uniform(random);
+        }
+        shuffle(stream.inserts.begin(), stream.inserts.end(), random);
+    } else if (name == "sorted") {
+        reverse(stream.inserts.begin(), stream.inserts.end());
+        for (size_t i = 0; i < n; i++) {
+            stream.lookups[i] = (int)(i % min(n, (size_t)64));
+        }
+    }
+    return stream;
+}
+
+
+// Ordered structures: insert the stream, look up, traverse, copy and erase everything.
+template<class Tree>
+struct BSTAdapter {
+    Tree tree;
+    void insert(int key) { tree.insert(key); }
+    bool contains(int key) const { return tree.search(key) != NULL; }
+    size_t containsBatch(const int *keys, size_t count, bool *results) const { return tree.contains_batch(keys, count, results); }
+    void erase(int key) { tree.erase(tree.search(key)); }
+    long long sum() const {
+        long long total = 0;
+        tree.visitInOrder([&total](const int &value) { total += value; });
+        return total;
+    }
+};
+
+// Inserts with the previously inserted node as the hint; only run on the sequential and sorted streams, where the
+// next key is always next to the previous one.
+template<class Tree>
+struct HintedBSTAdapter : BSTAdapter<Tree> {
+    BSTNode<int> *last = NULL;
+    HintedBSTAdapter(void) {}
+    // a copy has nodes of its own; it starts without a hint
+    HintedBSTAdapter(const HintedBSTAdapter &adapter) : BSTAdapter<Tree>(adapter) {}
+    void insert(int key) { last = this->tree.insert(last, key); }
+};
+
+template<class Set>
+struct SetAdapter {
+    Set tree;
+    void insert(int key) { tree.insert(key); }
+    bool contains(int key) const { return tree.find(key) != tree.end(); }
+    void erase(int key) { tree.erase(tree.find(key)); }
+    long long sum() const {
+        long long total = 0;
+        for (typename Set::const_iterator it = tree.begin(); it != tree.end(); ++it) {
+            total += *it;
+        }
+        return total;
+    }
+};
+
+template<class Tree>
+struct BTreeAdapter {
+    Tree tree;
+    void insert(int key) { tree.insert(key); }
+    bool contains(int key) const { return tree.search(key) != nullptr; }
+    void erase(int key) { tree.erase(key); }
+    long long sum() const {
+        long long total = 0;
+        tree.visitInOrder([&total](const int &value) { total += value; });
+        return total;
+    }
+};
+
+template<class Multiset>
+struct MultisetAdapter {
+    Multiset tree;
+    void insert(int key) { tree.insert(key); }
+    bool contains(int key) const { return tree.contains(key); }
+    void erase(int key) { tree.erase_one(key); }
+    long long sum() const {
+        long long total = 0;
+        tree.visitDistinct([&total](const int &value, size_t count) { total += (long long)value * count; });
+        return total;
+    }
+};
+
+volatile long long sink;
+
+// HasBatch<Adapter>::value is true if Adapter can look up a batch of keys at once
+template<class Adapter, class = void>
+struct HasBatch : false_type {};
+
+template<class Adapter>
+struct HasBatch<Adapter, void_t<decltype(declval<const Adapter&>().containsBatch(NULL, 0, NULL))> > : true_type {};
+
+template<class Adapter>
+void benchmarkOrdered(const string &structure, const Stream &stream, bool balanced) {
+    size_t n = stream.inserts.size();
+    if (!balanced && stream.name != "random" && stream.name != "zipfian" && stream.name != "hotset" && n > 20000) {
+        reportSkipped(structure, stream.name, n, "quadratic on this stream");
+        return;
+    }
+    resetPeakRSS();
+    Adapter *adapter = new Adapter();
+    runPhase(structure, stream.name, n, "insert", n, [&](size_t i) { adapter->insert(stream.inserts[i]); });
+    size_t found = 0;
+    runPhase(structure, stream.name, n, "search", n, [&](size_t i) { found += adapter->contains(stream.lookups[i]); });
+    sink = found;
+    if constexpr (HasBatch<Adapter>::value) {
+        // the same lookups, 256 per call
+        const size_t batch = 256;
+        bool answers[batch];
+        runPhase(structure, stream.name, n, "search_batch", n / batch, [&](size_t i) {
+            found += adapter->containsBatch(&stream.lookups[i * batch], batch, answers);
+        }, batch);
+        sink = found;
+    }
+    runPhase(structure, stream.name, n, "traverse", 1, [&](size_t) { sink = adapter->sum(); }, n);
+    Adapter *copy = NULL;
+    runPhase(structure, stream.name, n, "copy", 1, [&](size_t) { copy = new Adapter(*adapter); }, n);
+    runPhase(structure, stream.name, n, "destroy", 1, [&](size_t) { delete copy; }, n);
+    runPhase(structure, stream.name, n, "erase", n, [&](size_t i) { adapter->erase(stream.inserts[i]); });
+    delete adapter;
+}
+
+// Caches: a get for every lookup of the stream, followed by a put when it misses. The hit rate is printed after
+// the phase.
+template<class Cache>
+void benchmarkCache(const string &structure, const Stream &stream) {
+    size_t n = stream.lookups.size();
+    resetPeakRSS();
+    Cache *cache = new Cache(max((size_t)1, n / 10));
+    runPhase(structure, stream.name, n, "get_or_put", n, [&](size_t i) {
+        int *value = cache->get(stream.lookups[i]);
+        if (value == NULL) {
+            cache->put(stream.lookups[i], (int)i);
+        } else {
+            sink = *value;
+        }
+    });
+    cout << "    hit rate " << (double)cache->hits() / max((size_t)1, n) << ", " << cache->evictions()
+         << " evictions" << endl;
+    delete cache;
+}
+
+
+// HasIndex<List>::value is true if List has operator[]
+template<class List, class = void>
+struct HasIndex : false_type {};
+
+template<class List>
+struct HasIndex<List, void_t<decltype(declval<List&>()[0])> > : true_type {};
+
+// Lists: append, traverse, copy, and remove from the front. Lists with operator[] are also read by index in order,
+// and take n / 10 inserts in the middle.
+template<class List>
+void benchmarkList(const string &structure, size_t n) {
+    resetPeakRSS();
+    List *list = new List();
+    runPhase(structure, "sequential", n, "push_back", n, [&](size_t i) { list->push_back((int)i); });
+    runPhase(structure, "sequential", n, "traverse", 1, [&](size_t) {
+        long long total = 0;
+        for (typename List::const_iterator it = list->begin(); it != list->end(); ++it) {
+            total += *it;
+        }
+        sink = total;
+    }, n);
+    if constexpr (HasIndex<List>::value) {
+        runPhase(structure, "sequential", n, "index", n, [&](size_t i) { sink = (*list)[i]; });
+        runPhase(structure, "sequential", n, "insert_middle", n / 10, [&](size_t i) { list->insert((int)i, list->size() / 2); });
+    }
+    List *copy = NULL;
+    runPhase(structure, "sequential", n, "copy", 1, [&](size_t) { copy = new List(*list); }, n);
+    runPhase(structure, "sequential", n, "destroy", 1, [&](size_t) { delete copy; }, n);
+    runPhase(structure, "sequential", n, "pop_front", n, [&](size_t) { list->pop_front(); });
+    delete list;
+}
+
+// DoublyLinkedList names its front removal erase(0).
+struct DoublyLinkedListAdapter : DoublyLinkedList<int> {
+    void pop_front() { erase(0); }
+};
+
+
+// Copy, destruction and reduce of one tree with 1, 2, 4, ... threads, up to the hardware threads (at least 8).
+template<class T>
+void benchmarkParallelWalks(const string &name, const vector<T> &values) {
+    typedef BST<T, less_equal<T>, AVLBalance> Tree;
+    Tree source;
+    source.assignSorted(values.begin(), values.end());
+    unsigned maxThreads = max(8u, thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        source.setParallelism(threads);
+        string structure = name + "/threads=" + to_string(threads);
+        Tree *copy = NULL;
+        size_t n = values.size();
+        runPhase(structure, "sorted", n, "copy", 1, [&](size_t) { copy = new Tree(source); }, n);
+        runPhase(structure, "sorted", n, "reduce", 1, [&](size_t) {
+            sink = source.reduce((size_t)0, [](const T &) { return (size_t)1; }, [](size_t a, size_t b) { return a + b; });
+        }, n);
+        runPhase(structure, "sorted", n, "destroy", 1, [&](size_t) { delete copy; }, n);
+    }
+}
+
+
+void writeJSON(const string &path) {
+    ofstream out(path);
+    out.precision(10);
+    out << "{\n  \"hardware_threads\": " << thread::hardware_concurrency() << ",\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result &r = results[i];
+        out << (i == 0 ? "\n" : ",\n") << "    {\"structure\": \"" << r.structure << "\", \"stream\": \"" << r.stream
+            << "\", \"size\": " << r.size << ", \"operation\": \"" << r.operation << "\"";
+        if (!r.skipped.empty()) {
+            out << ", \"skipped\": \"" << r.skipped << "\"}";
+            continue;
+        }
+        out << ", \"ops\": " << r.ops << ", \"seconds\": " << r.seconds << ", \"ops_per_sec\": " << r.ops / r.seconds
+            << ", \"p50_ns\": " << r.p50 << ", \"p90_ns\": " << r.p90 << ", \"p99_ns\": " << r.p99
+            << ", \"p999_ns\": " << r.p999 << ", \"allocations_per_op\": " << r.allocationsPerOp
+            << ", \"peak_rss_kib\": " << r.peakRSS << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+bool selected(const string &filter, const string &name) {
+    return filter.empty() || name.find(filter) != string::npos;
+}
+
+int main(int argc, char **argv) {
+    vector<size_t> sizes = {1000, 10000, 100000, 1000000};
+    string filter, jsonPath;
+    size_t parallelCount = 0;
+    for (int i = 1; i < argc; i++) {
+        string argument = argv[i];
+        if (argument.compare(0, 8, "--sizes=") == 0) {
+            sizes.clear();
+            stringstream list(argument.substr(8));
+            string size;
+            while (getline(list, size, ',')) {
+                sizes.push_back(strtoull(size.c_str(), NULL, 10));
+            }
+        } else if (argument.compare(0, 9, "--filter=") == 0) {
+            filter = argument.substr(9);
+        } else if (argument.compare(0, 7, "--json=") == 0) {
+            jsonPath = argument.substr(7);
+        } else if (argument.compare(0, 11, "--parallel=") == 0) {
+            parallelCount = strtoull(argument.c_str() + 11, NULL, 10);
+        } else {
+            cerr << "unknown argument " << argument << endl;
+            return 1;
+        }
+    }
+
+    if (parallelCount > 0) {
+        vector<string> words;
+        vector<int> numbers;
+        for (size_t i = 0; i < parallelCount; i++) {
+            words.push_back("value-" + to_string(1000000000 + i) + "-padded-past-small-string-size");
+            numbers.push_back((int)i);
+        }
+        benchmarkParallelWalks("BST<string>", words);
+        benchmarkParallelWalks("BST<int>", numbers);
+    } else {
+        const char *streams[] = {"sequential", "random", "zipfian", "hotset", "sorted", "repeated"};
+        for (size_t s = 0; s < sizes.size(); s++) {
+            for (size_t k = 0; k < 6; k++) {
+                Stream stream = makeStream(streams[k], sizes[s]);
+                string suffix = string("/") + streams[k];
+                if (selected(filter, "BST" + suffix)) {
+                    benchmarkOrdered<BSTAdapter<BST<int> > >("BST", stream, false);
+                }
+                if (selected(filter, "BST<AVL>" + suffix)) {
+                    benchmarkOrdered<BSTAdapter<BST<int, less_equal<int>, AVLBalance> > >("BST<AVL>", stream, true);
+                }
+                if (selected(filter, "BST<Splay>" + suffix)) {
+                    benchmarkOrdered<BSTAdapter<BST<int, less_equal<int>, SplayBalance> > >("BST<Splay>", stream, true);
+                }
+                if (selected(filter, "BST<FreqSplay>" + suffix)) {
+                    benchmarkOrdered<BSTAdapter<BST<int, less_equal<int>, FrequencySplayBalance> > >("BST<FreqSplay>", stream, true);
+                }
+                if (selected(filter, "BST<AVL,hinted>" + suffix) && (stream.name == "sequential" || stream.name == "sorted")) {
+                    benchmarkOrdered<HintedBSTAdapter<BST<int, less_equal<int>, AVLBalance> > >("BST<AVL,hinted>", stream, true);
+                }
+                if (selected(filter, "BSTMultiset" + suffix)) {
+                    benchmarkOrdered<MultisetAdapter<BSTMultiset<int> > >("BSTMultiset", stream, false);
+                }
+                if (selected(filter, "BSTMultiset<AVL>" + suffix)) {
+                    benchmarkOrdered<MultisetAdapter<BSTMultiset<int, less_equal<int>, AVLBalance> > >("BSTMultiset<AVL>", stream, true);
+                }
+                if (selected(filter, "BTree<256B>" + suffix)) {
+                    benchmarkOrdered<BTreeAdapter<BTree<int> > >("BTree<256B>", stream, true);
+                }
+                if (selected(filter, "BTree<64B>" + suffix)) {
+                    benchmarkOrdered<BTreeAdapter<BTree<int, less_equal<int>, 64> > >("BTree<64B>", stream, true);
+                }
+                if (selected(filter, "LRUCache<AVL>" + suffix) && (stream.name == "random" || stream.name == "zipfian" || stream.name == "hotset")) {
+                    benchmarkCache<LRUCache<int, int> >("LRUCache<AVL>", stream);
+                }
+                if (selected(filter, "std::set" + suffix) && stream.name != "repeated") {
+                    benchmarkOrdered<SetAdapter<set<int> > >("std::set", stream, true);
+                }
+                if (selected(filter, "std::multiset" + suffix)) {
+                    benchmarkOrdered<SetAdapter<multiset<int> > >("std::multiset", stream, true);
+                }
+            }
+            if (selected(filter, "DoublyLinkedList/sequential")) {
+                benchmarkList<DoublyLinkedListAdapter>("DoublyLinkedList", sizes[s]);
+            }
+            if (selected(filter, "UnrolledDoublyLinkedList/sequential")) {
+                benchmarkList<UnrolledDoublyLinkedList<int> >("UnrolledDoublyLinkedList", sizes[s]);
+            }
+            if (selected(filter, "std::list/sequential")) {
+                benchmarkList<list<int> >("std::list", sizes[s]);
+            }
+        }
+    }
+
+    if (!jsonPath.empty()) {
+        writeJSON(jsonPath);
+    }
+    return 0;
+}
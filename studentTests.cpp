@@ -1,5 +1,34 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 #include "BST.hpp"
+#include "BST.tpp"
+#include "BSTMap.hpp"
+#include "BSTMap.tpp"
+#include "BSTMultiset.hpp"
+#include "BSTMultiset.tpp"
+#include "BTree.hpp"
+#include "BTree.tpp"
+#include "ConcurrentBST.hpp"
+#include "ConcurrentBST.tpp"
+#include "MappedBST.hpp"
+#include "MappedBST.tpp"
+#include "LRUCache.hpp"
+#include "LRUCache.tpp"
+#include "UnrolledDoublyLinkedList.hpp"
+#include "UnrolledDoublyLinkedList.tpp"
 
 using namespace std;
 
@@ -37,6 +66,24 @@ void testBSTNode() {
     assert(node1.treeMin() == &node2);
     assert(node1.treeMax() == &node3);
 
+    // Subtrees built with the setters can be walked, since the setters link the parents too
+    BSTNode<int> a(10), b(5), c(15), d(12);
+    a.setLeftChild(&b);
+    a.setRightChild(&c);
+    c.setLeftChild(&d);
+    assert(b.getParent() == &a && d.getParent() == &c);
+    assert(a.getInOrderTraversal().size() == 4);
+    int inOrder[] = {5, 10, 12, 15};
+    int preOrder[] = {10, 5, 15, 12};
+    int postOrder[] = {5, 12, 15, 10};
+    DoublyLinkedList<int> in = a.getInOrderTraversal(), pre = a.getPreOrderTraversal(), post = a.getPostOrderTraversal();
+    for (int i = 0; i < 4; i++) {
+        assert(in[i] == inOrder[i] && pre[i] == preOrder[i] && post[i] == postOrder[i]);
+    }
+    assert(c.getInOrderTraversal().size() == 2);
+    assert(b.successor() == &a && a.successor() == &d && d.successor() == &c && c.successor() == nullptr);
+    assert(c.predecessor() == &d && d.predecessor() == &a && b.predecessor() == nullptr);
+
     cout << "BSTNode tests passed!" << endl;
 }
 
@@ -80,8 +127,1763 @@ void testBST() {
     cout << "BST tests passed!" << endl;
 }
 
+// Height of a subtree, counted from its links.
+template<class T>
+int subtreeHeight(BSTNode<T> *node) {
+    if (node == nullptr) {
+        return 0;
+    }
+    return 1 + max(subtreeHeight(node->getLeftChild()), subtreeHeight(node->getRightChild()));
+}
+
+// Checks parent links, ordering and the AVL property of a subtree of a tree whose nodes are Node; returns its
+// height.
+template<class Node = BST<int, less_equal<int>, AVLBalance>::Node>
+int checkAVL(BSTNode<int> *node) {
+    if (node == nullptr) {
+        return 0;
+    }
+    if (node->getLeftChild() != nullptr) {
+        assert(node->getLeftChild()->getParent() == node);
+        assert(node->getLeftChild()->getValue() <= node->getValue());
+    }
+    if (node->getRightChild() != nullptr) {
+        assert(node->getRightChild()->getParent() == node);
+        assert(node->getRightChild()->getValue() >= node->getValue());
+    }
+    int leftHeight = checkAVL<Node>(node->getLeftChild());
+    int rightHeight = checkAVL<Node>(node->getRightChild());
+    assert(leftHeight - rightHeight <= 1 && rightHeight - leftHeight <= 1);
+    assert(Node::heightOf(node) == 1 + max(leftHeight, rightHeight));
+    return Node::heightOf(node);
+}
+
+void testBalancedBST() {
+    // Nodes store only the fields their policy keeps
+    static_assert(sizeof(BST<int>::Node) == sizeof(BSTNode<int>), "NoBalance nodes hold a value and three links");
+    static_assert(sizeof(BST<int, less_equal<int>, SplayBalance>::Node) == sizeof(BSTNode<int>), "so do splay nodes");
+    static_assert(sizeof(BST<int, less_equal<int>, OrderStatistics<> >::Node) == sizeof(BSTNode<int>) + sizeof(size_t), "order statistics add a size");
+    static_assert(sizeof(BST<int, less_equal<int>, AVLBalance>::Node) > sizeof(BSTNode<int>) &&
+                  sizeof(BST<int, less_equal<int>, AVLBalance>::Node) < sizeof(BST<int, less_equal<int>, OrderStatistics<AVLBalance> >::Node),
+                  "AVL nodes add a height, and order-statistic AVL nodes a size as well");
+
+    BST<int, less_equal<int>, AVLBalance> tree;
+
+    // Sorted input would turn an unbalanced tree into a list
+    BSTNode<int>* handles[1024];
+    for (int i = 0; i < 1024; i++) {
+        handles[i] = tree.insert(i);
+    }
+    assert(tree.size() == 1024);
+    BSTNode<int>* root = tree.treeMin();
+    while (root->getParent() != nullptr) {
+        root = root->getParent();
+    }
+    assert(checkAVL(root) == 11);
+
+    // Handles stay valid across rotations
+    for (int i = 0; i < 1024; i++) {
+        assert(tree.search(i) == handles[i]);
+    }
+
+    // Erase every other key, including nodes with two children
+    for (int i = 0; i < 1024; i += 2) {
+        tree.erase(handles[i]);
+    }
+    assert(tree.size() == 512);
+    root = tree.treeMin();
+    while (root->getParent() != nullptr) {
+        root = root->getParent();
+    }
+    assert(checkAVL(root) <= 10);
+    assert(tree.treeMin()->getValue() == 1);
+    assert(tree.treeMax()->getValue() == 1023);
+    assert(tree.search(512) == nullptr);
+
+    // Copies keep the shape and the parent links
+    BST<int, less_equal<int>, AVLBalance> copy(tree);
+    assert(copy.size() == 512);
+    assert(copy.getInOrderTraversal() == tree.getInOrderTraversal());
+
+    cout << "Balanced BST tests passed!" << endl;
+}
+
+void testBSTIterators() {
+    BST<int> tree;
+    assert(tree.begin() == tree.end());
+    assert(tree.rbegin() == tree.rend());
+
+    int values[] = {10, 5, 15, 3, 7, 12, 20};
+    for (int value : values) {
+        tree.insert(value);
+    }
+
+    // In order, forwards and backwards
+    int expected[] = {3, 5, 7, 10, 12, 15, 20};
+    int i = 0;
+    for (BST<int>::iterator it = tree.begin(); it != tree.end(); ++it) {
+        assert(*it == expected[i++]);
+    }
+    assert(i == 7);
+    for (BST<int>::reverse_iterator it = tree.rbegin(); it != tree.rend(); ++it) {
+        assert(*it == expected[--i]);
+    }
+    assert(i == 0);
+    assert(*(--tree.end()) == 20);
+
+    // Visitors agree with the traversals
+    int preOrder[] = {10, 5, 3, 7, 15, 12, 20};
+    int postOrder[] = {3, 7, 5, 12, 20, 15, 10};
+    i = 0;
+    tree.visitPreOrder([&](const int &value) { assert(value == preOrder[i++]); });
+    assert(i == 7);
+    i = 0;
+    tree.visitPostOrder([&](const int &value) { assert(value == postOrder[i++]); });
+    assert(i == 7);
+    i = 0;
+    tree.visitInOrder([&](const int &value) { assert(value == expected[i++]); });
+    assert(i == 7);
+    DoublyLinkedList<int> pre = tree.getPreOrderTraversal();
+    DoublyLinkedList<int> post = tree.getPostOrderTraversal();
+    for (i = 0; i < 7; i++) {
+        assert(pre[i] == preOrder[i]);
+        assert(post[i] == postOrder[i]);
+    }
+
+    // Iterators hand out the nodes for erase
+    tree.erase(tree.begin().getNode());
+    assert(*tree.begin() == 5);
+
+    cout << "BST iterator tests passed!" << endl;
+}
+
+void testPoolAllocator() {
+    // Freed slots are handed out again
+    PoolAllocator<int> pool;
+    int *first = pool.allocate(1);
+    pool.deallocate(first, 1);
+    int *second = pool.allocate(1);
+    assert(first == second);
+    pool.deallocate(second, 1);
+
+    // Copies share the pool, default-constructed allocators do not
+    PoolAllocator<double> rebound(pool);
+    assert(rebound == pool);
+    assert(PoolAllocator<int>() != pool);
+    assert(!pool.uniquePool());
+
+    // Trees recycle erased nodes and free non-trivial values on destruction
+    BST<string> words;
+    BSTNode<string>* node = words.insert("pool");
+    words.erase(node);
+    assert(words.insert("recycled") == node);
+    for (int i = 0; i < 100; i++) {
+        words.insert(to_string(i));
+    }
+    assert(words.size() == 101);
+
+    // Lists take their nodes from the pool too
+    DoublyLinkedList<string> list;
+    for (int i = 0; i < 100; i++) {
+        list.push_back(to_string(i));
+    }
+    list.erase(50);
+    list.insert("fifty", 50);
+    assert(list[50] == "fifty");
+    DoublyLinkedList<string> copy(list);
+    assert(copy == list);
+
+    // Trees can share one pool
+    PoolAllocator<int> shared;
+    BST<int, less_equal<int>, NoBalance, PoolAllocator<int> > a(less_equal<int>(), shared);
+    BST<int, less_equal<int>, NoBalance, PoolAllocator<int> > b(less_equal<int>(), shared);
+    BSTNode<int>* fromA = a.insert(1);
+    a.erase(fromA);
+    assert(b.insert(2) == fromA);
+
+    // Standard allocators work as well
+    BST<int, less_equal<int>, AVLBalance, allocator<int> > plain;
+    plain.insert(1);
+    assert(plain.size() == 1);
+
+    // Arrays are checked for overflow and aligned for over-aligned types
+    bool threw = false;
+    try {
+        pool.allocate(pool.max_size() + 1);
+    } catch (const bad_array_new_length &) {
+        threw = true;
+    }
+    assert(threw);
+    struct alignas(64) CacheLine { char bytes[64]; };
+    PoolAllocator<CacheLine> lines;
+    CacheLine *array = lines.allocate(3);
+    assert(reinterpret_cast<uintptr_t>(array) % 64 == 0);
+    lines.deallocate(array, 3);
+
+    cout << "Pool allocator tests passed!" << endl;
+}
+
+// Allocator whose instances with different tags cannot free each other's memory, so lists using them cannot
+// adopt each other's nodes.
+template<class T>
+struct TaggedAllocator {
+    typedef T value_type;
+    int tag;
+
+    TaggedAllocator(int tag = 0) : tag(tag) {}
+    template<class U>
+    TaggedAllocator(const TaggedAllocator<U> &other) : tag(other.tag) {}
+    T* allocate(size_t n) { return std::allocator<T>().allocate(n); }
+    void deallocate(T *pointer, size_t n) { std::allocator<T>().deallocate(pointer, n); }
+    template<class U>
+    bool operator==(const TaggedAllocator<U> &other) const { return tag == other.tag; }
+    template<class U>
+    bool operator!=(const TaggedAllocator<U> &other) const { return tag != other.tag; }
+};
+
+// Value that counts how often it is copied.
+struct CopyCounted {
+    static size_t copies;
+    int value;
+
+    CopyCounted(int value = 0) : value(value) {}
+    CopyCounted(const CopyCounted &other) : value(other.value) { copies++; }
+    CopyCounted(CopyCounted &&other) noexcept : value(other.value) {}
+    CopyCounted& operator=(const CopyCounted &other) { value = other.value; copies++; return *this; }
+    CopyCounted& operator=(CopyCounted &&other) noexcept { value = other.value; return *this; }
+};
+size_t CopyCounted::copies = 0;
+
+void testDoublyLinkedListMoves() {
+    DoublyLinkedList<string> list;
+    string word = "moved";
+    list.push_back(std::move(word));
+    list.emplace_back(3, 'x');
+    list.emplace_front("front");
+    assert(list.size() == 3);
+    assert(list[0] == "front" && list[1] == "moved" && list[2] == "xxx");
+
+    // Moving leaves the source empty and usable
+    DoublyLinkedList<string> moved(std::move(list));
+    assert(moved.size() == 3);
+    assert(list.empty());
+    list.push_back("again");
+    assert(list.size() == 1);
+
+    // The moved-from list gets a pool of its own, so the two can be used from different threads
+    assert(!(moved.get_allocator() == list.get_allocator()));
+
+    // Assigning from a temporary swaps the nodes in
+    list = DoublyLinkedList<string>(moved);
+    assert(list == moved);
+
+    // Splicing and appending relink nodes, even across pools
+    DoublyLinkedList<int> a, b, c;
+    for (int i = 0; i < 3; i++) {
+        a.push_back(i);
+        b.push_back(10 + i);
+        c.push_back(20 + i);
+    }
+    a.append(std::move(b));
+    a.splice(1, std::move(c));
+    assert(b.empty() && c.empty());
+    int expected[] = {0, 20, 21, 22, 1, 2, 10, 11, 12};
+    assert(a.size() == 9);
+    for (int i = 0; i < 9; i++) {
+        assert(a[i] == expected[i]);
+    }
+    assert(a.pop_back() == 12);
+    a.erase(6);
+
+    // Concatenating temporaries reuses their nodes
+    DoublyLinkedList<int> joined = DoublyLinkedList<int>(a).concatenate(DoublyLinkedList<int>(a));
+    assert(joined.size() == 14);
+    assert(a.concatenate(a) == joined);
+
+    // Lists that cannot adopt each other's nodes move the values over instead of copying them
+    DoublyLinkedList<CopyCounted, TaggedAllocator<CopyCounted> > into(TaggedAllocator<CopyCounted>(1));
+    DoublyLinkedList<CopyCounted, TaggedAllocator<CopyCounted> > from(TaggedAllocator<CopyCounted>(2));
+    for (int i = 0; i < 5; i++) {
+        into.emplace_back(i);
+        from.emplace_back(10 + i);
+    }
+    CopyCounted::copies = 0;
+    into.splice(2, std::move(from));
+    assert(CopyCounted::copies == 0 && from.empty() && into.size() == 10);
+    assert(into[1].value == 1 && into[2].value == 10 && into[6].value == 14 && into[7].value == 2);
+
+    cout << "DoublyLinkedList move tests passed!" << endl;
+}
+
+// Height of the tree a node belongs to.
+int treeHeight(BSTNode<int> *node) {
+    if (node == nullptr) {
+        return 0;
+    }
+    return 1 + max(treeHeight(node->getLeftChild()), treeHeight(node->getRightChild()));
+}
+
+void testBulkConstruction() {
+    // Sorted input no longer degenerates
+    vector<int> sorted;
+    for (int i = 0; i < 1000; i++) {
+        sorted.push_back(i);
+    }
+    BST<int> tree(sorted.begin(), sorted.end());
+    assert(tree.size() == 1000);
+    BSTNode<int>* root = tree.treeMin();
+    while (root->getParent() != nullptr) {
+        root = root->getParent();
+    }
+    assert(treeHeight(root) == 10);
+    int expected = 0;
+    for (BST<int>::iterator it = tree.begin(); it != tree.end(); ++it) {
+        assert(*it == expected++);
+    }
+
+    // Unsorted input with duplicates is sorted first
+    int shuffled[] = {5, 3, 9, 1, 5, 7, 0};
+    tree.assign(shuffled, shuffled + 7);
+    assert(tree.size() == 7);
+    int inOrder[] = {0, 1, 3, 5, 5, 7, 9};
+    DoublyLinkedList<int> dump = tree.getInOrderTraversal();
+    for (int i = 0; i < 7; i++) {
+        assert(dump[i] == inOrder[i]);
+    }
+    assert(tree.search(5) != nullptr);
+    assert(tree.search(4) == nullptr);
+
+    // Rebuilding from a dump keeps the contents; AVL trees come out balanced
+    BST<int, less_equal<int>, AVLBalance> rebuilt(dump);
+    assert(rebuilt.getInOrderTraversal() == dump);
+    rebuilt.insert(6);
+    rebuilt.erase(rebuilt.search(1));
+    root = rebuilt.treeMin();
+    while (root->getParent() != nullptr) {
+        root = root->getParent();
+    }
+    checkAVL(root);
+
+    // Empty ranges give empty trees
+    tree.assign(sorted.begin(), sorted.begin());
+    assert(tree.empty());
+
+    cout << "Bulk construction tests passed!" << endl;
+}
+
+void testFrozenBST() {
+    BST<int> tree;
+    assert(tree.freeze().empty());
+    for (int i = 0; i < 1000; i++) {
+        tree.insert((i * 7919) % 1000 * 2);
+    }
+    FrozenBST<int> frozen = tree.freeze();
+    assert(frozen.size() == 1000);
+    for (int i = 0; i < 2000; i++) {
+        const int *found = frozen.search(i);
+        if (i % 2 == 0) {
+            assert(found != nullptr && *found == i);
+            assert(*frozen.lower_bound(i) == i);
+        } else {
+            assert(found == nullptr);
+            assert(!frozen.contains(i));
+            if (i < 1999) {
+                assert(*frozen.lower_bound(i) == i + 1);
+            }
+        }
+    }
+    assert(*frozen.lower_bound(-5) == 0);
+    assert(frozen.lower_bound(1999) == nullptr);
+
+    // Sizes that do not fill the last level
+    int values[] = {1, 2, 2, 4, 8};
+    FrozenBST<int> small(values, values + 5);
+    assert(small.search(2) != nullptr && *small.search(2) == 2);
+    assert(*small.lower_bound(3) == 4);
+    assert(small.search(5) == nullptr);
+
+    cout << "FrozenBST tests passed!" << endl;
+}
+
+typedef BST<int, less_equal<int>, OrderStatistics<AVLBalance> >::Node CountedNode;
+
+// Checks the subtree sizes of a subtree of an order-statistic AVL tree; returns its size.
+size_t checkSizes(BSTNode<int> *node) {
+    if (node == nullptr) {
+        return 0;
+    }
+    size_t size = 1 + checkSizes(node->getLeftChild()) + checkSizes(node->getRightChild());
+    assert(CountedNode::sizeOf(node) == size);
+    return size;
+}
+
+void testOrderStatistics() {
+    BST<int, less_equal<int>, OrderStatistics<AVLBalance> > tree;
+    vector<BSTNode<int>*> handles;
+    for (int i = 0; i < 200; i++) {
+        handles.push_back(tree.insert((i * 37) % 200));
+    }
+    for (size_t k = 0; k < 200; k++) {
+        assert(tree.select(k)->getValue() == (int) k);
+        assert(tree.rank((int) k) == k);
+    }
+    assert(tree.count_range(10, 19) == 10);
+    assert(tree.count_range(19, 10) == 0);
+    assert(tree.count_range(-50, 500) == 200);
+
+    // Sizes survive erases, including the two-child case
+    for (int i = 0; i < 200; i += 3) {
+        tree.erase(handles[i]);
+    }
+    BSTNode<int>* root = tree.treeMin();
+    while (root->getParent() != nullptr) {
+        root = root->getParent();
+    }
+    assert(checkSizes(root) == tree.size());
+    size_t k = 0;
+    for (BST<int, less_equal<int>, OrderStatistics<AVLBalance> >::iterator it = tree.begin(); it != tree.end(); ++it, ++k) {
+        assert(tree.select(k)->getValue() == *it);
+        assert(tree.rank(*it) == k);
+    }
+    bool threw = false;
+    try {
+        tree.select(tree.size());
+    } catch (out_of_range &) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Unbalanced trees, copies and bulk builds keep sizes too
+    BST<int, less_equal<int>, OrderStatistics<> > plain;
+    int values[] = {5, 1, 9, 3, 7};
+    for (int value : values) {
+        plain.insert(value);
+    }
+    plain.erase(plain.search(5));
+    BST<int, less_equal<int>, OrderStatistics<> > copy(plain);
+    assert(copy.select(2)->getValue() == 7);
+    copy.assign(values, values + 5);
+    assert(copy.rank(6) == 3);
+
+    cout << "Order statistic tests passed!" << endl;
+}
+
+void testRangeQueries() {
+    BST<int, less_equal<int>, AVLBalance> tree;
+    for (int i = 0; i < 100; i += 10) {
+        tree.insert(i);
+    }
+    tree.insert(50);
+    tree.insert(50);
+
+    assert(*tree.lower_bound(35) == 40);
+    assert(*tree.lower_bound(40) == 40);
+    assert(*tree.upper_bound(40) == 50);
+    assert(*tree.lower_bound(-1) == 0);
+    assert(tree.lower_bound(91) == tree.end());
+    assert(tree.upper_bound(90) == tree.end());
+
+    // Duplicates form one contiguous range
+    pair<BST<int, less_equal<int>, AVLBalance>::iterator, BST<int, less_equal<int>, AVLBalance>::iterator> range = tree.equal_range(50);
+    int count = 0;
+    for (BST<int, less_equal<int>, AVLBalance>::iterator it = range.first; it != range.second; ++it) {
+        assert(*it == 50);
+        count++;
+    }
+    assert(count == 3);
+    assert(tree.search(50) == range.first.getNode());
+    range = tree.equal_range(55);
+    assert(range.first == range.second);
+
+    // Range scans stop at hi
+    vector<int> seen;
+    tree.visitRange(15, 60, [&seen](const int &value) { seen.push_back(value); });
+    int expected[] = {20, 30, 40, 50, 50, 50, 60};
+    assert(seen.size() == 7);
+    for (int i = 0; i < 7; i++) {
+        assert(seen[i] == expected[i]);
+    }
+    seen.clear();
+    tree.visitRange(61, 69, [&seen](const int &value) { seen.push_back(value); });
+    assert(seen.empty());
+
+    cout << "Range query tests passed!" << endl;
+}
+
+void testConcurrentBST() {
+    ConcurrentBST<int> tree;
+    assert(tree.empty());
+    assert(!tree.search(5).has_value());
+    assert(!tree.erase(5));
+
+    // Single-threaded behaviour matches BST
+    for (int i = 0; i < 1000; i++) {
+        tree.insert((i * 7919) % 1000);
+    }
+    assert(tree.size() == 1000);
+    for (int i = 0; i < 1000; i++) {
+        assert(tree.contains(i));
+    }
+    assert(*tree.lower_bound(-3) == 0);
+    assert(!tree.lower_bound(1000).has_value());
+    for (int i = 0; i < 1000; i += 2) {
+        assert(tree.erase(i));
+    }
+    assert(tree.size() == 500);
+    assert(!tree.contains(10));
+    assert(*tree.search(11) == 11);
+    assert(*tree.lower_bound(10) == 11);
+
+    // Odd keys are stable; even keys churn while readers run
+    const int numReaders = 4;
+    atomic<bool> done(false);
+    atomic<bool> failed(false);
+    vector<thread> readers;
+    for (int r = 0; r < numReaders; r++) {
+        readers.push_back(thread([&tree, &done, &failed, r]() {
+            int key = r;
+            while (!done.load()) {
+                key = (key + 37) % 1000;
+                int odd = key | 1;
+                optional<int> bound = tree.lower_bound(odd - 1);
+                if (!tree.contains(odd) || *tree.search(odd) != odd || !bound.has_value() || *bound < odd - 1 || *bound > odd) {
+                    failed.store(true);
+                }
+            }
+        }));
+    }
+    for (int round = 0; round < 20; round++) {
+        for (int i = 0; i < 1000; i += 2) {
+            tree.insert(i);
+        }
+        for (int i = 0; i < 1000; i += 2) {
+            assert(tree.erase(i));
+        }
+    }
+    done.store(true);
+    for (size_t r = 0; r < readers.size(); r++) {
+        readers[r].join();
+    }
+    assert(!failed.load());
+    assert(tree.size() == 500);
+
+    // Read throughput across thread counts, with one writer churning in the background
+    const int lookupsPerThread = 200000;
+    for (int threads = 1; threads <= 8; threads *= 2) {
+        done.store(false);
+        thread writer([&tree, &done]() {
+            while (!done.load()) {
+                tree.insert(2000);
+                tree.erase(2000);
+            }
+        });
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        readers.clear();
+        for (int t = 0; t < threads; t++) {
+            readers.push_back(thread([&tree, t]() {
+                for (int i = 0; i < lookupsPerThread; i++) {
+                    tree.contains((i * 31 + t) % 1000);
+                }
+            }));
+        }
+        for (size_t t = 0; t < readers.size(); t++) {
+            readers[t].join();
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        done.store(true);
+        writer.join();
+        cout << "  " << threads << " reader thread(s): " << (threads * lookupsPerThread / seconds / 1e6) << " M lookups/s" << endl;
+    }
+    assert(tree.size() == 500);
+
+    cout << "Concurrent BST tests passed!" << endl;
+}
+
+void testPersistentBST() {
+    PersistentBST<int> tree;
+    assert(tree.empty());
+    assert(tree.begin() == tree.end());
+    assert(!tree.erase(3));
+
+    for (int i = 0; i < 1000; i++) {
+        tree.insert((i * 7919) % 1000);
+    }
+    assert(tree.size() == 1000);
+    assert(tree.height() <= 14);
+    int expected = 0;
+    for (PersistentBST<int>::iterator it = tree.begin(); it != tree.end(); ++it) {
+        assert(*it == expected++);
+    }
+    assert(expected == 1000);
+
+    // Copies share everything until one of them changes
+    PersistentBST<int> snapshot = tree;
+    assert(snapshot.sharesRootWith(tree));
+    for (int i = 0; i < 1000; i += 2) {
+        assert(tree.erase(i));
+    }
+    tree.insert(5000);
+    assert(!snapshot.sharesRootWith(tree));
+    assert(tree.size() == 501);
+    assert(snapshot.size() == 1000);
+    assert(!tree.contains(10) && snapshot.contains(10));
+    assert(tree.contains(5000) && !snapshot.contains(5000));
+    assert(*tree.lower_bound(10) == 11);
+    assert(*snapshot.lower_bound(10) == 10);
+    assert(tree.lower_bound(5001) == nullptr);
+    assert(tree.height() <= 12);
+    expected = 0;
+    snapshot.visitInOrder([&expected](const int &value) { assert(value == expected++); });
+    assert(expected == 1000);
+
+    // Duplicates, and snapshots of a BST
+    BST<int, less_equal<int>, AVLBalance> source;
+    int values[] = {4, 2, 6, 4, 4};
+    for (int i = 0; i < 5; i++) {
+        source.insert(values[i]);
+    }
+    PersistentBST<int> fromBST = source.snapshot();
+    assert(fromBST.size() == 5);
+    PersistentBST<int> older = fromBST;
+    assert(fromBST.erase(4));
+    assert(fromBST.erase(4));
+    assert(fromBST.contains(4));
+    assert(fromBST.erase(4));
+    assert(!fromBST.contains(4));
+    assert(older.size() == 5 && older.contains(4));
+    assert(source.search(4) != NULL);
+
+    // The BST queries and traversals, on the same shape as a BST built from the same values
+    int sorted[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    BST<int> reference(sorted, sorted + 10);
+    PersistentBST<int> standIn(sorted, sorted + 10);
+    assert(standIn.treeMin() == 1 && standIn.treeMax() == 10);
+    assert(standIn.getPreOrderTraversal() == reference.getPreOrderTraversal());
+    assert(standIn.getInOrderTraversal() == reference.getInOrderTraversal());
+    assert(standIn.getPostOrderTraversal() == reference.getPostOrderTraversal());
+    bool threw = false;
+    try {
+        PersistentBST<int>().getInOrderTraversal();
+    } catch (const length_error &) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        PersistentBST<int>().treeMin();
+    } catch (const length_error &) {
+        threw = true;
+    }
+    assert(threw);
+
+    cout << "Persistent BST tests passed!" << endl;
+}
+
+void testParallelWalks() {
+    // A degenerate chain: copying and destroying must not recurse once per level
+    BST<int> chain;
+    chain.setParallelism(1);
+    for (int i = 0; i < 10000; i++) {
+        chain.insert(i);
+    }
+    BST<int> chainCopy(chain);
+    assert(chainCopy.size() == 10000);
+    assert(chainCopy.treeMax()->getValue() == 9999);
+    assert(chainCopy.reduce(0LL, [](const int &value) { return (long long)value; }, [](long long a, long long b) { return a + b; }) == 49995000LL);
+    chainCopy.erase(chainCopy.search(5000));
+    assert(chainCopy.search(5000) == NULL && chain.search(5000) != NULL);
+
+    // Large trees split between threads, with pooled non-trivial values
+    vector<string> words;
+    for (int i = 0; i < 100000; i++) {
+        words.push_back("w" + to_string(1000000 + i));
+    }
+    BST<string, less_equal<string>, AVLBalance> tree;
+    tree.setParallelism(4);
+    tree.assignSorted(words.begin(), words.end());
+    BST<string, less_equal<string>, AVLBalance> copy(tree);
+    assert(copy.size() == 100000);
+    size_t index = 0;
+    for (BST<string, less_equal<string>, AVLBalance>::iterator it = copy.begin(); it != copy.end(); ++it) {
+        assert(*it == words[index++]);
+        BSTNode<string> *parent = it.getNode()->getParent();
+        assert(parent == NULL || parent->getLeftChild() == it.getNode() || parent->getRightChild() == it.getNode());
+    }
+    size_t letters = copy.reduce((size_t)0, [](const string &word) { return word.size(); }, [](size_t a, size_t b) { return a + b; });
+    assert(letters == 8 * 100000);
+    // Nodes copied by other threads can be erased and reused by this one
+    for (int i = 0; i < 100000; i += 3) {
+        copy.erase(copy.search(words[i]));
+    }
+    copy.insert("w0");
+    assert(copy.size() == 100000 - 33334 + 1);
+    copy = tree;
+    assert(copy.size() == 100000);
+
+    // Exact subtree sizes and a thread-safe allocator
+    vector<int> numbers;
+    for (int i = 0; i < 60000; i++) {
+        numbers.push_back(i);
+    }
+    BST<int, less_equal<int>, OrderStatistics<AVLBalance>, allocator<int> > counted(numbers.begin(), numbers.end());
+    counted.setParallelism(8);
+    BST<int, less_equal<int>, OrderStatistics<AVLBalance>, allocator<int> > countedCopy(counted);
+    assert(countedCopy.select(12345)->getValue() == 12345);
+    assert(countedCopy.count_range(100, 199) == 100);
+    BSTNode<int> *countedRoot = countedCopy.treeMin();
+    while (countedRoot->getParent() != NULL) {
+        countedRoot = countedRoot->getParent();
+    }
+    assert(checkSizes(countedRoot) == 60000);
+    checkAVL<CountedNode>(countedRoot);
+    long long total = countedCopy.reduce(0LL, [](const int &value) { return (long long)value; }, [](long long a, long long b) { return a + b; });
+    assert(total == 59999LL * 60000LL / 2);
+
+    cout << "Parallel walk tests passed!" << endl;
+}
+
+// Values of a tree in order, checking parent links, AVL heights and subtree sizes on the way.
+vector<int> checkedValues(BST<int, less_equal<int>, OrderStatistics<AVLBalance> > &tree) {
+    vector<int> values;
+    if (!tree.empty()) {
+        BSTNode<int> *root = tree.treeMin();
+        while (root->getParent() != NULL) {
+            root = root->getParent();
+        }
+        checkAVL<CountedNode>(root);
+        assert(checkSizes(root) == tree.size());
+    }
+    for (BST<int, less_equal<int>, OrderStatistics<AVLBalance> >::iterator it = tree.begin(); it != tree.end(); ++it) {
+        values.push_back(*it);
+    }
+    assert(values.size() == tree.size());
+    return values;
+}
+
+void testSetAlgebra() {
+    typedef BST<int, less_equal<int>, OrderStatistics<AVLBalance> > Tree;
+    srand(271);
+    // Sizes hit both the linear walk and the one-at-a-time path for small trees
+    size_t sizes[][2] = {{0, 0}, {0, 50}, {50, 0}, {300, 280}, {2000, 7}, {5, 400}};
+    for (size_t test = 0; test < 6; test++) {
+        for (int operation = 0; operation < 4; operation++) {
+            vector<int> a, b;
+            for (size_t i = 0; i < sizes[test][0]; i++) {
+                a.push_back(rand() % 200);
+            }
+            for (size_t i = 0; i < sizes[test][1]; i++) {
+                b.push_back(rand() % 200);
+            }
+            Tree first(a.begin(), a.end());
+            Tree second(b.begin(), b.end());
+            sort(a.begin(), a.end());
+            sort(b.begin(), b.end());
+            vector<int> expected;
+            if (operation == 0) {
+                merge(a.begin(), a.end(), b.begin(), b.end(), back_inserter(expected));
+                first.merge(std::move(second));
+            } else if (operation == 1) {
+                set_union(a.begin(), a.end(), b.begin(), b.end(), back_inserter(expected));
+                first.unite(std::move(second));
+            } else if (operation == 2) {
+                set_intersection(a.begin(), a.end(), b.begin(), b.end(), back_inserter(expected));
+                first.intersect(std::move(second));
+            } else {
+                set_difference(a.begin(), a.end(), b.begin(), b.end(), back_inserter(expected));
+                first.subtract(std::move(second));
+            }
+            assert(second.empty() && second.begin() == second.end());
+            assert(checkedValues(first) == expected);
+            // The nodes taken over stay usable
+            if (!first.empty()) {
+                first.erase(first.select(first.size() / 2));
+                first.insert(100);
+                checkedValues(first);
+            }
+        }
+    }
+
+    // Split and join reuse the nodes and keep the order
+    vector<int> values;
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(i / 2);
+    }
+    Tree tree(values.begin(), values.end());
+    BSTNode<int> *handle = tree.search(300);
+    Tree upper = tree.split(250);
+    assert(tree.size() == 500 && upper.size() == 500);
+    assert(tree.treeMax()->getValue() == 249 && upper.treeMin()->getValue() == 250);
+    assert(upper.search(300) == handle);
+    checkedValues(tree);
+    checkedValues(upper);
+    Tree empty = upper.split(10000);
+    assert(empty.empty() && upper.size() == 500);
+    Tree all = tree.split(-1);
+    assert(tree.empty() && all.size() == 500);
+    tree = std::move(all);
+
+    bool threw = false;
+    try {
+        upper.join(std::move(tree));
+    } catch (invalid_argument &e) {
+        threw = true;
+    }
+    assert(threw && tree.size() == 500 && upper.size() == 500);
+    tree.join(std::move(upper));
+    assert(upper.empty());
+    assert(checkedValues(tree) == values);
+
+    // A half that goes to another thread is copied there, away from the shared pool
+    Tree shard = tree.split(250);
+    Tree ownPool(shard);
+    shard = Tree();
+    thread worker([&ownPool]() {
+        for (int i = 0; i < 1000; i++) {
+            ownPool.insert(1000 + i);
+        }
+    });
+    for (int i = 0; i < 1000; i++) {
+        tree.insert(-1 - i);
+    }
+    worker.join();
+    assert(tree.size() == 1500 && ownPool.size() == 1500);
+    tree.join(std::move(ownPool));
+    for (int i = 0; i < 2000; i++) {
+        tree.erase(tree.search((i < 1000) ? -1 - i : i));
+    }
+    assert(checkedValues(tree) == values);
+
+    // Move construction and assignment hand the nodes over; the moved-from tree gets a pool of its own
+    Tree moved(std::move(tree));
+    assert(tree.empty() && moved.size() == 1000);
+    assert(!(moved.get_allocator() == tree.get_allocator()));
+    tree = std::move(moved);
+    assert(tree.size() == 1000 && moved.empty());
+    tree.insert(7);
+    assert(tree.count_range(7, 7) == 3);
+
+    // A tree can be combined with itself
+    Tree twice(values.begin(), values.begin() + 10);
+    Tree &alias = twice;
+    twice.merge(std::move(alias));
+    assert(twice.size() == 20);
+    twice.unite(std::move(alias));
+    assert(twice.size() == 20);
+    twice.subtract(std::move(alias));
+    assert(twice.empty());
+
+    // Unbalanced trees with non-trivial values come out balanced
+    BST<string> left, right;
+    for (int i = 0; i < 100; i++) {
+        left.insert(to_string(1000 + 2 * i));
+        right.insert(to_string(1000 + 3 * i));
+    }
+    left.unite(std::move(right));
+    BSTNode<string> *top = left.treeMin();
+    while (top->getParent() != NULL) {
+        top = top->getParent();
+    }
+    assert(left.size() == 166 && subtreeHeight(top) == 8);
+
+    cout << "Set algebra tests passed!" << endl;
+}
+
+// Three-way comparator that counts its calls; transparent like std::compare_three_way.
+struct CountingThreeWay {
+    typedef void is_transparent;
+    static size_t calls;
+
+    template<class A, class B>
+    auto operator()(const A &a, const B &b) const {
+        calls++;
+        return a <=> b;
+    }
+};
+size_t CountingThreeWay::calls = 0;
+
+void testBSTMap() {
+    BSTMap<string, int> ages;
+    assert(ages.empty() && ages.begin() == ages.end());
+    assert(ages.try_emplace("bob", 31).second);
+    assert(ages.insert(pair<const string, int>("alice", 29)).second);
+    ages["carol"] = 40;
+    assert(ages.size() == 3);
+    assert(ages.at("alice") == 29 && ages["bob"] == 31);
+
+    // try_emplace leaves an existing entry and its arguments alone
+    string key = "bob";
+    pair<BSTMap<string, int>::iterator, bool> result = ages.try_emplace(std::move(key), 99);
+    assert(!result.second && result.first->second == 31 && key == "bob");
+    result = ages.insert_or_assign("bob", 32);
+    assert(!result.second && ages.at("bob") == 32);
+    result = ages.insert_or_assign(string("dave"), 50);
+    assert(result.second && result.first->first == "dave");
+
+    // Lookups with a string_view build no string
+    string_view view = "carol";
+    assert(ages.contains(view) && ages.find(view)->second == 40);
+    assert(ages.lower_bound(string_view("b"))->first == "bob");
+    assert(ages.upper_bound(string_view("bob"))->first == "carol");
+    assert(ages.find(string_view("eve")) == ages.end());
+    ages.at(string_view("dave")) += 1;
+    assert(ages["dave"] == 51);
+
+    // Iteration in key order; values are writable, keys are not
+    string expected[] = {"alice", "bob", "carol", "dave"};
+    size_t index = 0;
+    for (BSTMap<string, int>::iterator it = ages.begin(); it != ages.end(); ++it) {
+        assert(it->first == expected[index++]);
+        it->second++;
+    }
+    assert(index == 4 && ages.at("alice") == 30);
+    const BSTMap<string, int> &constAges = ages;
+    BSTMap<string, int>::const_iterator last = constAges.end();
+    --last;
+    assert(last->first == "dave" && constAges.at("dave") == 52);
+    assert(constAges.find("bob") != constAges.end());
+
+    // Erase by key and by iterator
+    assert(ages.erase("bob") == 1 && ages.erase("bob") == 0);
+    BSTMap<string, int>::iterator next = ages.erase(ages.find("alice"));
+    assert(next->first == "carol" && ages.size() == 2);
+    bool threw = false;
+    try {
+        ages.at("alice");
+    } catch (out_of_range &e) {
+        threw = true;
+    }
+    assert(threw);
+    BSTMap<string, int> copy = ages;
+    ages.clear();
+    assert(ages.empty() && copy.size() == 2 && copy.at("carol") == 41);
+
+    // One three-way comparison per level
+    BSTMap<int, string, CountingThreeWay, AVLBalance> numbers;
+    for (int i = 0; i < 1023; i++) {
+        numbers.try_emplace(i, to_string(i));
+    }
+    for (int i = 0; i < 1023; i++) {
+        CountingThreeWay::calls = 0;
+        assert(numbers.find(i)->second == to_string(i));
+        assert(CountingThreeWay::calls <= 10);
+    }
+    CountingThreeWay::calls = 0;
+    assert(!numbers.contains(5000));
+    assert(CountingThreeWay::calls <= 10);
+
+    cout << "BSTMap tests passed!" << endl;
+}
+
+void testBSTStats() {
+    // Sorted inserts degenerate an unbalanced tree into a chain, which the depths show
+    typedef BST<int, less_equal<int>, NoBalance, PoolAllocator<int>, CountingStats> CountedTree;
+    // the default policy takes no space
+    static_assert(sizeof(BST<int>) + sizeof(CountingStats) == sizeof(CountedTree), "NoStats should be free");
+    CountedTree chain;
+    for (int i = 0; i < 100; i++) {
+        chain.insert(i);
+    }
+    CountingStats::Snapshot stats = chain.stats();
+    assert(stats.inserts == 100 && stats.allocations == 100);
+    assert(stats.maxInsertDepth == 99);
+    // depths 0..99 visited the parents, one comparison each
+    assert(stats.comparisons == 99 * 100 / 2);
+    assert(stats.insertDepths[0] == 1 && stats.insertDepths[1] == 1 && stats.insertDepths[7] == 36);
+    assert(chain.search(99) != NULL);
+    stats = chain.stats();
+    assert(stats.searches == 1 && stats.maxSearchDepth == 100 && stats.searchDepths[7] == 1);
+
+    // The same values in an AVL tree stay within 1.44 log2(n)
+    BST<int, less_equal<int>, AVLBalance, PoolAllocator<int>, CountingStats> balanced;
+    for (int i = 0; i < 100; i++) {
+        balanced.insert(i);
+    }
+    assert(balanced.search(99) != NULL && balanced.stats().maxSearchDepth <= 10);
+
+    // Erases, with and without two children, and the nodes they give back
+    CountedTree small;
+    BSTNode<int> *middle = small.insert(2);
+    small.insert(1);
+    BSTNode<int> *leaf = small.insert(3);
+    small.erase(middle);
+    small.erase(leaf);
+    stats = small.stats();
+    assert(stats.erases == 2 && stats.twoChildErases == 1 && stats.deallocations == 2);
+
+    // Copies count the nodes they allocate and start their own counters
+    CountedTree copy(chain);
+    stats = copy.stats();
+    assert(stats.allocations == 100 && stats.inserts == 0 && stats.comparisons == 0);
+    int values[] = {3, 1, 2};
+    copy.assign(values, values + 3);
+    stats = copy.stats();
+    assert(stats.deallocations == 100 && stats.allocations == 103);
+
+    cout << "Stats tests passed!" << endl;
+}
+
+void testSnapshotFiles() {
+    string path = "/tmp/studentTests_snapshot.bin";
+    BST<int> tree;
+    for (int i = 0; i < 1000; i++) {
+        tree.insert((i * 37) % 1000 * 2);
+    }
+    tree.save(path);
+
+    // Loading rebuilds the stored complete tree, which satisfies the AVL property
+    BST<int, less_equal<int>, AVLBalance> loaded;
+    loaded.insert(-5);
+    loaded.load(path);
+    assert(loaded.size() == 1000 && loaded.search(-5) == NULL);
+    BSTNode<int> *root = loaded.treeMin();
+    while (root->getParent() != NULL) {
+        root = root->getParent();
+    }
+    assert(checkAVL(root) == 10);
+    int expected = 0;
+    loaded.visitInOrder([&expected](int value) {
+        assert(value == expected);
+        expected += 2;
+    });
+    assert(expected == 2000);
+    // and is kept balanced from there
+    loaded.insert(1);
+    loaded.erase(loaded.search(0));
+    for (root = loaded.treeMin(); root->getParent() != NULL; root = root->getParent()) {
+    }
+    assert(checkAVL(root) > 0);
+
+    // The mapped view searches the file without loading it
+    MappedBST<int> mapped(path);
+    assert(mapped.size() == 1000 && !mapped.empty());
+    assert(mapped.contains(1998) && !mapped.contains(7));
+    assert(*mapped.search(500) == 500);
+    assert(*mapped.lower_bound(7) == 8 && mapped.lower_bound(1999) == nullptr);
+    MappedBST<int> moved(std::move(mapped));
+    assert(mapped.empty() && moved.contains(0));
+
+    // Empty trees round trip too
+    BST<int> empty;
+    empty.save(path);
+    MappedBST<int> none(path);
+    assert(none.empty() && none.search(3) == nullptr);
+    loaded.load(path);
+    assert(loaded.empty());
+
+    // Files of another type, or no file at all, are rejected
+    tree.save(path);
+    bool threw = false;
+    try {
+        MappedBST<double> wrong(path);
+    } catch (const runtime_error &) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        loaded.load("/tmp/studentTests_missing.bin");
+    } catch (const runtime_error &) {
+        threw = true;
+    }
+    assert(threw && loaded.empty());
+
+    // Truncated files, and a header-only file claiming 2^64 - 1 values, are rejected
+    tree.save(path);
+    string bytes;
+    {
+        ifstream in(path, ios::binary);
+        bytes.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    }
+    {
+        ofstream out(path, ios::binary | ios::trunc);
+        out.write(bytes.data(), sizeof(FrozenSnapshotHeader) + 10 * sizeof(int));
+    }
+    threw = false;
+    try {
+        MappedBST<int> truncated(path);
+    } catch (const runtime_error &) {
+        threw = true;
+    }
+    assert(threw);
+    FrozenSnapshotHeader forged;
+    memcpy(&forged, bytes.data(), sizeof(forged));
+    forged.count = UINT64_MAX;
+    {
+        ofstream out(path, ios::binary | ios::trunc);
+        out.write(reinterpret_cast<const char*>(&forged), sizeof(forged));
+    }
+    threw = false;
+    try {
+        MappedBST<int> headerOnly(path);
+    } catch (const runtime_error &) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        loaded.load(path);
+    } catch (const runtime_error &) {
+        threw = true;
+    }
+    assert(threw && loaded.empty());
+    remove(path.c_str());
+
+    cout << "Snapshot file tests passed!" << endl;
+}
+
+void testBSTMultiset() {
+    // Repeated keys share a node
+    BSTMultiset<int, less_equal<int>, AVLBalance> events;
+    for (int i = 0; i < 1000; i++) {
+        events.insert(i % 10);
+    }
+    assert(events.size() == 1000 && events.distinct_size() == 10);
+    assert(events.count(3) == 100 && events.count(10) == 0);
+    assert(events.contains(9) && !events.contains(-1));
+
+    // Iteration expands the counts, in both directions
+    size_t visited = 0;
+    int previous = 0;
+    for (BSTMultiset<int, less_equal<int>, AVLBalance>::iterator it = events.begin(); it != events.end(); ++it) {
+        assert(*it >= previous && *it == (int)(visited / 100));
+        previous = *it;
+        visited++;
+    }
+    assert(visited == 1000);
+    BSTMultiset<int, less_equal<int>, AVLBalance>::iterator last = events.end();
+    --last;
+    assert(*last == 9);
+    for (int i = 0; i < 100; i++) {
+        --last;
+    }
+    assert(*last == 8);
+    assert(distance(events.find(4), events.upper_bound(4)) == 100);
+    assert(*events.lower_bound(-3) == 0 && events.upper_bound(9) == events.end());
+
+    // Erasing one copy, all copies, and through iterators
+    assert(events.erase_one(5) && events.count(5) == 99 && events.size() == 999);
+    assert(events.erase_all(5) == 99 && !events.contains(5) && events.distinct_size() == 9);
+    assert(!events.erase_one(5) && events.erase_all(5) == 0);
+    BSTMultiset<int, less_equal<int>, AVLBalance>::iterator it = events.find(6);
+    for (int i = 0; i < 99; i++) {
+        it = events.erase(it);
+        assert(*it == 6);
+    }
+    it = events.erase(it);
+    assert(*it == 7 && !events.contains(6) && events.size() == 800);
+
+    // visitDistinct sees each value once, with its count
+    size_t total = 0;
+    events.visitDistinct([&total](int value, size_t count) {
+        assert(count == 100 && value != 5 && value != 6);
+        total += count;
+    });
+    assert(total == events.size());
+
+    // Copies are deep, and equal values keep the first one inserted
+    BSTMultiset<int, less_equal<int>, AVLBalance> copy(events);
+    copy.clear();
+    assert(copy.empty() && events.size() == 800);
+    vector<string> words = {"pear", "apple", "pear", "fig", "apple", "pear"};
+    BSTMultiset<string> bag(words.begin(), words.end());
+    assert(bag.size() == 6 && bag.distinct_size() == 3 && bag.count("pear") == 3);
+    vector<string> expanded(bag.begin(), bag.end());
+    assert((expanded == vector<string>{"apple", "apple", "fig", "pear", "pear", "pear"}));
+
+    cout << "BSTMultiset tests passed!" << endl;
+}
+
+// A value nearly as large as a default B-tree node.
+struct WideRecord {
+    int key;
+    char payload[236];
+
+    bool operator<=(const WideRecord &other) const { return key <= other.key; }
+};
+
+void testBTree() {
+    // Small nodes make the tree deep enough to split, borrow and merge at every level
+    BTree<int, less_equal<int>, 64> tree;
+    multiset<int> reference;
+    assert(tree.empty() && tree.height() == 0 && tree.search(1) == nullptr);
+    srand(18);
+    for (int i = 0; i < 20000; i++) {
+        int value = rand() % 3000;
+        if (rand() % 3 != 0) {
+            tree.insert(value);
+            reference.insert(value);
+        } else {
+            bool erased = tree.erase(value);
+            assert(erased == (reference.count(value) != 0));
+            if (erased) {
+                reference.erase(reference.find(value));
+            }
+        }
+    }
+    assert(tree.size() == reference.size() && tree.height() >= 3);
+    assert(equal(tree.begin(), tree.end(), reference.begin(), reference.end()));
+    assert(tree.treeMin() == *reference.begin() && tree.treeMax() == *reference.rbegin());
+    for (int value = -1; value <= 3000; value++) {
+        assert((tree.search(value) != nullptr) == (reference.count(value) != 0));
+        assert(distance(tree.lower_bound(value), tree.upper_bound(value)) == (ptrdiff_t)reference.count(value));
+    }
+    BTree<int, less_equal<int>, 64>::iterator last = tree.end();
+    --last;
+    assert(*last == *reference.rbegin());
+
+    // The traversals all list the values in order
+    DoublyLinkedList<int> inOrder = tree.getInOrderTraversal();
+    assert(inOrder.size() == reference.size());
+    assert(equal(inOrder.begin(), inOrder.end(), reference.begin()));
+    assert(tree.getPreOrderTraversal().size() == inOrder.size());
+
+    // Copies are deep; erasing everything empties the tree level by level
+    BTree<int, less_equal<int>, 64> copy(tree);
+    for (multiset<int>::iterator it = reference.begin(); it != reference.end(); ++it) {
+        assert(tree.erase(*it));
+    }
+    assert(tree.empty() && tree.height() == 0 && tree.begin() == tree.end());
+    assert(copy.size() == reference.size() && equal(copy.begin(), copy.end(), reference.begin()));
+    tree = copy;
+    assert(tree.size() == copy.size());
+    BTree<int, less_equal<int>, 64> moved(std::move(copy));
+    assert(copy.empty() && moved.size() == tree.size() && !(moved.get_allocator() == copy.get_allocator()));
+    copy.insert(1);
+    assert(copy.size() == 1);
+
+    // Values that are not trivially copyable, with the default node size
+    BTree<string> words;
+    for (int i = 0; i < 500; i++) {
+        words.insert("word" + to_string(i % 250));
+    }
+    assert(words.size() == 500 && *words.search("word42") == "word42");
+    assert(words.erase("word42") && words.erase("word42") && !words.erase("word42"));
+    assert(words.treeMin() == "word0" && words.treeMax() == "word99");
+    bool threw = false;
+    try {
+        BTree<int>().treeMin();
+    } catch (const length_error &) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Values too large for the node still get the minimum fan-out
+    BTree<WideRecord> records;
+    for (int i = 0; i < 300; i++) {
+        WideRecord record = WideRecord();
+        record.key = (i * 7) % 300;
+        records.insert(record);
+    }
+    WideRecord probe = WideRecord();
+    probe.key = 123;
+    assert(records.size() == 300 && records.search(probe)->key == 123 && records.height() > 1);
+    assert(records.erase(probe) && records.search(probe) == nullptr && records.treeMax().key == 299);
+
+    cout << "BTree tests passed!" << endl;
+}
+
+// Applies the same random positional edits to a list and to a vector, checking that they agree.
+template<class List>
+void checkPositionalEdits(List &list, unsigned seed) {
+    vector<int> expected;
+    srand(seed);
+    for (int step = 0; step < 4000; step++) {
+        int choice = rand() % 10;
+        if (choice < 4 || expected.empty()) {
+            size_t index = rand() % (expected.size() + 1);
+            list.insert(step, index);
+            expected.insert(expected.begin() + index, step);
+        } else if (choice < 6) {
+            size_t index = rand() % expected.size();
+            list.erase(index);
+            expected.erase(expected.begin() + index);
+        } else if (choice == 6) {
+            list.push_front(step);
+            expected.insert(expected.begin(), step);
+        } else if (choice == 7) {
+            assert(list.pop_front() == expected.front());
+            expected.erase(expected.begin());
+        } else if (choice == 8) {
+            assert(list.pop_back() == expected.back());
+            expected.pop_back();
+        } else {
+            size_t index = rand() % expected.size();
+            assert(list[index] == expected[index]);
+        }
+    }
+    assert(list.size() == expected.size());
+    // In order, backwards, and by iterator
+    for (size_t i = 0; i < expected.size(); i++) {
+        assert(list[i] == expected[i]);
+    }
+    for (size_t i = expected.size(); i-- > 0;) {
+        assert(list[i] == expected[i]);
+    }
+    assert(equal(list.begin(), list.end(), expected.begin(), expected.end()));
+    if (!expected.empty()) {
+        assert(list.search(expected.back()) == expected.size() - 1);
+    }
+    assert(list.search(-1) == list.size());
+}
+
+void testUnrolledDoublyLinkedList() {
+    // The cursor of DoublyLinkedList follows the edits
+    DoublyLinkedList<int> plain;
+    checkPositionalEdits(plain, 19);
+
+    // Small chunks split and merge often
+    typedef UnrolledDoublyLinkedList<int, PoolAllocator<int>, 64> SmallChunks;
+    SmallChunks list;
+    checkPositionalEdits(list, 19);
+    UnrolledDoublyLinkedList<int> large;
+    checkPositionalEdits(large, 20);
+
+    // Equality does not depend on how the elements are chunked
+    SmallChunks front, back;
+    for (int i = 0; i < 100; i++) {
+        front.push_front(99 - i);
+        back.push_back(i);
+    }
+    assert(front == back);
+    back[50] = -1;
+    assert(front != back);
+
+    // Splicing into the middle of a chunk, appending, and concatenating
+    SmallChunks a, b, c;
+    for (int i = 0; i < 30; i++) {
+        a.push_back(i);
+        b.push_back(100 + i);
+        c.push_back(200 + i);
+    }
+    a.splice(7, std::move(b));
+    a.append(std::move(c));
+    assert(b.empty() && c.empty() && a.size() == 90);
+    assert(a[6] == 6 && a[7] == 100 && a[36] == 129 && a[37] == 7 && a[60] == 200 && a[89] == 229);
+    SmallChunks joined = SmallChunks(a).concatenate(SmallChunks(a));
+    assert(joined.size() == 180 && joined == a.concatenate(a));
+    SmallChunks::iterator last = joined.end();
+    assert(*--last == 229);
+    UnrolledDoublyLinkedList<CopyCounted, TaggedAllocator<CopyCounted>, 64> into(TaggedAllocator<CopyCounted>(1));
+    UnrolledDoublyLinkedList<CopyCounted, TaggedAllocator<CopyCounted>, 64> from(TaggedAllocator<CopyCounted>(2));
+    for (int i = 0; i < 40; i++) {
+        into.emplace_back(i);
+        from.emplace_back(100 + i);
+    }
+    CopyCounted::copies = 0;
+    into.splice(20, std::move(from));
+    assert(CopyCounted::copies == 0 && from.empty() && into.size() == 80);
+    assert(into[19].value == 19 && into[20].value == 100 && into[59].value == 139 && into[60].value == 20);
+
+    // Values that own memory are moved between chunks, copied, and assigned
+    UnrolledDoublyLinkedList<string, PoolAllocator<string>, 64> words;
+    for (int i = 0; i < 50; i++) {
+        words.insert(string(20, 'a' + i % 26), words.size() / 2);
+    }
+    words.emplace_front(3, 'x');
+    assert(words[0] == "xxx" && words.size() == 51);
+    UnrolledDoublyLinkedList<string, PoolAllocator<string>, 64> copy(words);
+    assert(copy == words);
+    while (words.size() > 5) {
+        words.erase(words.size() / 3);
+    }
+    copy = std::move(words);
+    assert(copy.size() == 5 && copy[0] == "xxx");
+    UnrolledDoublyLinkedList<string, PoolAllocator<string>, 64> moved(std::move(copy));
+    assert(copy.empty() && moved.size() == 5 && !(moved.get_allocator() == copy.get_allocator()));
+    copy = std::move(moved);
+
+    bool threw = false;
+    try {
+        copy[5];
+    } catch (const out_of_range &) {
+        threw = true;
+    }
+    assert(threw);
+
+    cout << "UnrolledDoublyLinkedList tests passed!" << endl;
+}
+
+void testHintedInsert() {
+    // Appending in order with the previous node as the hint takes one comparison per insert
+    typedef BST<int, less_equal<int>, AVLBalance, PoolAllocator<int>, CountingStats> CountedTree;
+    CountedTree appended;
+    BSTNode<int> *last = NULL;
+    for (int i = 0; i < 1000; i++) {
+        last = appended.insert(last, i);
+    }
+    CountingStats::Snapshot stats = appended.stats();
+    assert(stats.inserts == 1000 && stats.comparisons == 999);
+    assert(appended.size() == 1000 && appended.treeMin()->getValue() == 0 && appended.treeMax()->getValue() == 999);
+
+    // Hints anywhere, duplicates included, give the same tree as inserting from the root
+    srand(20);
+    BST<int> plain, hinted;
+    BST<int, less_equal<int>, AVLBalance> plainAVL, hintedAVL;
+    vector<BSTNode<int>*> nodes, nodesAVL;
+    for (int i = 0; i < 2000; i++) {
+        int value = rand() % 500;
+        plain.insert(value);
+        plainAVL.insert(value);
+        BSTNode<int> *hint = nodes.empty() ? NULL : nodes[rand() % nodes.size()];
+        nodes.push_back(hinted.insert(hint, value));
+        // AVL rotations move nodes around, but every node stays in the tree
+        hint = nodesAVL.empty() ? NULL : nodesAVL[rand() % nodesAVL.size()];
+        nodesAVL.push_back(hintedAVL.emplace_hint(hint, value));
+    }
+    assert(hinted.getPreOrderTraversal() == plain.getPreOrderTraversal());
+    assert(hintedAVL.getPreOrderTraversal() == plainAVL.getPreOrderTraversal());
+    assert(hintedAVL.getInOrderTraversal() == plainAVL.getInOrderTraversal());
+
+    // Values on either side of the hint, and far from it
+    BST<string> words;
+    BSTNode<string> *middle = words.insert("m");
+    words.emplace_hint(middle, 1, 'a');
+    words.insert(middle, "z");
+    words.insert(middle, "n");
+    words.emplace_hint(words.search("a"), "zz");
+    DoublyLinkedList<string> expected;
+    expected.push_back("a");
+    expected.push_back("m");
+    expected.push_back("n");
+    expected.push_back("z");
+    expected.push_back("zz");
+    assert(words.getInOrderTraversal() == expected);
+
+    cout << "Hinted insert tests passed!" << endl;
+}
+
+void testSplayBalance() {
+    typedef BST<int, less_equal<int>, SplayBalance, PoolAllocator<int>, CountingStats> SplayTree;
+    SplayTree tree;
+    // Inserting in order leaves a chain, each insert splaying the new maximum to the root
+    for (int i = 0; i < 1000; i++) {
+        tree.insert(i);
+    }
+    assert(tree.stats().comparisons == 999);
+
+    // A lookup brings its node to the root, so repeating it is cheap
+    BSTNode<int> *hot = tree.search(0);
+    assert(hot != NULL && hot->getParent() == NULL);
+    CountingStats::Snapshot before = tree.stats();
+    for (int i = 0; i < 100; i++) {
+        assert(tree.search(0) == hot);
+    }
+    assert(tree.stats().comparisons - before.comparisons <= 100 * 3);
+    // Splaying the deepest node of the chain roughly halved the depth of the rest
+    assert(tree.stats().maxSearchDepth == 1000);
+    before = tree.stats();
+    assert(tree.search(500) != NULL);
+    assert(tree.stats().comparisons - before.comparisons < 600);
+    BSTNode<int> *max = tree.treeMax();
+    assert(max->getValue() == 999 && max->getParent() == NULL);
+
+    // Random operations against std::multiset, with lookups of absent values and duplicates
+    srand(21);
+    BST<int, less_equal<int>, SplayBalance> random;
+    multiset<int> expected;
+    for (int step = 0; step < 5000; step++) {
+        int value = rand() % 300;
+        int choice = rand() % 4;
+        if (choice < 2) {
+            random.insert(value);
+            expected.insert(value);
+        } else if (choice == 2) {
+            BSTNode<int> *node = random.search(value);
+            assert((node != NULL) == (expected.count(value) > 0));
+            if (node != NULL) {
+                random.erase(node);
+                expected.erase(expected.find(value));
+            }
+        } else {
+            BST<int, less_equal<int>, SplayBalance>::iterator it = random.lower_bound(value);
+            multiset<int>::iterator want = expected.lower_bound(value);
+            assert((it == random.end()) == (want == expected.end()));
+            if (want != expected.end()) {
+                assert(*it == *want);
+            }
+        }
+    }
+    assert(random.size() == expected.size());
+    assert(equal(random.begin(), random.end(), expected.begin(), expected.end()));
+
+    // Rotations keep subtree sizes for order statistics
+    BST<int, less_equal<int>, OrderStatistics<SplayBalance> > ranked;
+    for (int i = 0; i < 200; i++) {
+        ranked.insert((i * 37) % 200);
+    }
+    for (int i = 0; i < 200; i += 7) {
+        assert(ranked.search(i) != NULL);
+        assert(ranked.select(i)->getValue() == i && ranked.rank(i) == (size_t)i);
+    }
+
+    cout << "Splay balance tests passed!" << endl;
+}
+
+void testFrequencySplayBalance() {
+    typedef BST<int, less_equal<int>, FrequencySplayBalance, PoolAllocator<int>, CountingStats> FrequencyTree;
+    static_assert(sizeof(FrequencyTree::Node) == sizeof(BSTNode<int>) + sizeof(size_t), "nodes add a lookup count");
+    // Inserts leave new leaves in place until a path gets too deep, then splay, so inserting in order keeps every
+    // path within about 50 levels, and so does a scan
+    FrequencyTree sorted;
+    for (int i = 0; i < 1000; i++) {
+        sorted.insert(i);
+    }
+    assert(sorted.stats().comparisons < 1000 * 50);
+    for (int i = 0; i < 1000; i++) {
+        assert(sorted.search(i)->getValue() == i);
+    }
+    assert(sorted.stats().maxSearchDepth <= 50);
+
+    // A lookup counts on the node it ends on: the node it finds if that has no left child, its predecessor
+    // otherwise. The first lookup of a node leaves it where it is; the second splays it past the nodes never
+    // looked up.
+    FrequencyTree tree;
+    for (int i = 0; i < 40; i++) {
+        tree.insert(i);
+    }
+    BSTNode<int> *hot = tree.search(39);
+    assert(hot != NULL && hot->getParent() != NULL);
+    assert(static_cast<FrequencyTree::Node *>(hot)->getAccesses() == 1);
+    assert(tree.search(39) == hot && hot->getParent() == NULL);
+
+    // Repeated lookups settle the key and its predecessor at the top, where a lookup costs a few comparisons
+    for (int i = 0; i < 20; i++) {
+        assert(tree.search(39) == hot);
+    }
+    BSTNode<int> *top = hot;
+    while (top->getParent() != NULL) {
+        top = top->getParent();
+    }
+    assert(top->getValue() >= 38);
+    CountingStats::Snapshot before = tree.stats();
+    assert(tree.search(39) == hot);
+    assert(tree.stats().comparisons - before.comparisons <= 3);
+
+    // A key looked up less often climbs past the cold nodes but stays below the hot ones
+    for (int i = 0; i < 3; i++) {
+        assert(tree.search(20)->getValue() == 20);
+    }
+    assert(top->getParent() == NULL);
+    before = tree.stats();
+    assert(tree.search(39) == hot);
+    assert(tree.stats().comparisons - before.comparisons <= 3);
+
+    // Random operations against std::multiset, with lookups of absent values and duplicates
+    srand(22);
+    BST<int, less_equal<int>, FrequencySplayBalance> random;
+    multiset<int> expected;
+    for (int step = 0; step < 5000; step++) {
+        int value = rand() % 300;
+        int choice = rand() % 4;
+        if (choice < 2) {
+            random.insert(value);
+            expected.insert(value);
+        } else if (choice == 2) {
+            BSTNode<int> *node = random.search(value);
+            assert((node != NULL) == (expected.count(value) > 0));
+            if (node != NULL) {
+                random.erase(node);
+                expected.erase(expected.find(value));
+            }
+        } else {
+            BST<int, less_equal<int>, FrequencySplayBalance>::iterator it = random.lower_bound(value);
+            multiset<int>::iterator want = expected.lower_bound(value);
+            assert((it == random.end()) == (want == expected.end()));
+            if (want != expected.end()) {
+                assert(*it == *want);
+            }
+        }
+    }
+    assert(random.size() == expected.size());
+    assert(equal(random.begin(), random.end(), expected.begin(), expected.end()));
+
+    // Rotations keep subtree sizes for order statistics; each key is looked up twice, so that it moves
+    BST<int, less_equal<int>, OrderStatistics<FrequencySplayBalance> > ranked;
+    for (int i = 0; i < 200; i++) {
+        ranked.insert((i * 37) % 200);
+    }
+    for (int i = 0; i < 200; i += 7) {
+        assert(ranked.search(i) != NULL);
+        assert(ranked.search(i) != NULL);
+        assert(ranked.select(i)->getValue() == i && ranked.rank(i) == (size_t)i);
+    }
+
+    cout << "Frequency splay balance tests passed!" << endl;
+}
+
+void testLRUCache() {
+    // Filling past the capacity evicts the least recently used key
+    LRUCache<int, string> cache(3);
+    assert(cache.empty() && cache.capacity() == 3);
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+    assert(cache.size() == 3 && cache.leastRecent() == 1 && cache.mostRecent() == 3);
+    cache.put(4, "four");
+    assert(cache.size() == 3 && !cache.contains(1) && cache.evictions() == 1);
+
+    // get() is a use, peek() and contains() are not
+    assert(*cache.get(2) == "two" && cache.mostRecent() == 2);
+    assert(*cache.peek(3) == "three" && cache.leastRecent() == 3);
+    cache.put(5, "five");
+    assert(!cache.contains(3) && cache.contains(2) && cache.evictions() == 2);
+    assert(cache.get(3) == nullptr && cache.hits() == 1 && cache.misses() == 1);
+
+    // put() on a present key assigns and uses it without evicting
+    cache.put(4, "FOUR");
+    assert(*cache.peek(4) == "FOUR" && cache.mostRecent() == 4 && cache.size() == 3 && cache.evictions() == 2);
+
+    // Visitors: by key and by recency
+    vector<int> keys;
+    cache.visitRange(3, 5, [&keys](int key, const string &) { keys.push_back(key); });
+    assert((keys == vector<int>{4, 5}));
+    keys.clear();
+    cache.visitRecent([&keys](int key, const string &) { keys.push_back(key); });
+    assert((keys == vector<int>{4, 5, 2}));
+
+    // Copies keep the order of use; moves take the counters along
+    LRUCache<int, string> copy(cache);
+    keys.clear();
+    copy.visitRecent([&keys](int key, const string &) { keys.push_back(key); });
+    assert((keys == vector<int>{4, 5, 2}) && copy.hits() == 0);
+    copy.put(6, "six");
+    assert(!copy.contains(2) && cache.contains(2));
+    LRUCache<int, string> moved(std::move(cache));
+    assert(cache.empty() && moved.size() == 3 && moved.hits() == 1 && moved.evictions() == 2);
+    cache = copy;
+    assert(cache.size() == 3 && cache.leastRecent() == 5);
+
+    // Erase and clear
+    assert(moved.erase(5) && !moved.erase(5) && moved.size() == 2);
+    assert(moved.leastRecent() == 2 && moved.mostRecent() == 4);
+    moved.clear();
+    assert(moved.empty() && moved.evictions() == 2);
+    moved.resetCounters();
+    assert(moved.hits() == 0 && moved.misses() == 0 && moved.evictions() == 0);
+    bool threw = false;
+    try {
+        moved.leastRecent();
+    }
+    catch (const length_error &) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        LRUCache<int, int> none(0);
+    }
+    catch (const invalid_argument &) {
+        threw = true;
+    }
+    assert(threw);
+
+    // A long run keeps exactly the last capacity keys, whatever the tree did to them
+    LRUCache<int, int> window(100);
+    for (int i = 0; i < 10000; i++) {
+        window.put((i * 7919) % 10007, i);
+    }
+    assert(window.size() == 100 && window.evictions() == 9900);
+    for (int i = 9900; i < 10000; i++) {
+        assert(window.contains((i * 7919) % 10007));
+    }
+    assert(window.leastRecent() == (9900 * 7919) % 10007);
+
+    cout << "LRU cache tests passed!" << endl;
+}
+
+void testBatchedSearch() {
+    // Every result matches search, for present and absent values and batches of any length
+    srand(23);
+    BST<int, less_equal<int>, AVLBalance> tree;
+    for (int i = 0; i < 3000; i++) {
+        tree.insert(rand() % 4000);
+    }
+    vector<int> keys;
+    for (int i = 0; i < 1000; i++) {
+        keys.push_back(rand() % 4200 - 100);
+    }
+    for (size_t count : {(size_t)0, (size_t)1, (size_t)15, (size_t)16, (size_t)17, keys.size()}) {
+        vector<BSTNode<int>*> nodes(count, (BSTNode<int>*)1);
+        tree.search_batch(keys.data(), count, nodes.data());
+        bool answers[1000];
+        size_t found = tree.contains_batch(keys.data(), count, answers);
+        size_t expected = 0;
+        for (size_t i = 0; i < count; i++) {
+            assert(nodes[i] == tree.search(keys[i]));
+            assert(answers[i] == (nodes[i] != NULL));
+            expected += answers[i];
+        }
+        assert(found == expected);
+    }
+
+    // Spans, and the counters: one search per value, as many comparisons as searching one at a time
+    typedef BST<int, less_equal<int>, AVLBalance, PoolAllocator<int>, CountingStats> CountedTree;
+    CountedTree counted;
+    for (int i = 0; i < 500; i++) {
+        counted.insert(i * 2);
+    }
+    CountingStats::Snapshot before = counted.stats();
+    vector<BSTNode<int>*> nodes(keys.size());
+    counted.search_batch(span<const int>(keys), span<BSTNode<int>*>(nodes));
+    CountingStats::Snapshot batched = counted.stats();
+    for (size_t i = 0; i < keys.size(); i++) {
+        assert(nodes[i] == counted.search(keys[i]));
+    }
+    CountingStats::Snapshot single = counted.stats();
+    assert(batched.searches - before.searches == keys.size());
+    assert(batched.comparisons - before.comparisons == single.comparisons - batched.comparisons);
+    bool threw = false;
+    try {
+        counted.search_batch(span<const int>(keys), span<BSTNode<int>*>(nodes).first(10));
+    }
+    catch (const invalid_argument &) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Splaying after each group leaves every node found in the tree, and the tree ordered
+    BST<int, less_equal<int>, SplayBalance> splayed;
+    for (int i = 0; i < 1000; i++) {
+        splayed.insert((i * 37) % 1000);
+    }
+    vector<int> some = {5, 999, 0, 500, 1200, 5, 77, -3, 640, 641, 642, 3, 900, 901, 4, 2, 333, 334};
+    vector<BSTNode<int>*> splayedNodes(some.size());
+    splayed.search_batch(some.data(), some.size(), splayedNodes.data());
+    for (size_t i = 0; i < some.size(); i++) {
+        bool present = some[i] >= 0 && some[i] < 1000;
+        assert(present ? splayedNodes[i]->getValue() == some[i] : splayedNodes[i] == NULL);
+    }
+    DoublyLinkedList<int> inOrder = splayed.getInOrderTraversal();
+    assert(inOrder.size() == 1000 && is_sorted(inOrder.begin(), inOrder.end()));
+
+    cout << "Batched search tests passed!" << endl;
+}
+
 int main() {
     testBSTNode();
     testBST();
+    testBalancedBST();
+    testBSTIterators();
+    testPoolAllocator();
+    testDoublyLinkedListMoves();
+    testBulkConstruction();
+    testFrozenBST();
+    testOrderStatistics();
+    testRangeQueries();
+    testConcurrentBST();
+    testPersistentBST();
+    testParallelWalks();
+    testSetAlgebra();
+    testBSTMap();
+    testBSTStats();
+    testSnapshotFiles();
+    testBSTMultiset();
+    testBTree();
+    testUnrolledDoublyLinkedList();
+    testHintedInsert();
+    testSplayBalance();
+    testFrequencySplayBalance();
+    testLRUCache();
+    testBatchedSearch();
     return 0;
 }